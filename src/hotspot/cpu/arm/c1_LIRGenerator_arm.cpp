@@ -1094,9 +1094,9 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
                                    LIR_OprFact::illegalOpr, info_for_exception);
   } else if (x->is_invokespecial_receiver_check()) {
     assert(patching_info == NULL, "can't patch this");
-    stub = new DeoptimizeStub(info_for_exception,
-                              Deoptimization::Reason_class_check,
-                              Deoptimization::Action_none);
+    stub = new DeoptimizeStub(info_for_exception, Deoptimization::Reason_class_check,
+                              x->is_profiled_receiver_check() ? Deoptimization::Action_make_not_entrant
+                                                              : Deoptimization::Action_none);
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id,
                                    LIR_OprFact::illegalOpr, info_for_exception);
@@ -1213,10 +1213,9 @@ void LIRGenerator::do_soft_float_compare(If* x) {
   }
   // Call float compare function, returns (1,0) if true or false.
   LIR_Opr result = call_runtime(x->x(), x->y(), runtime_func, intType, NULL);
-  __ cmp(lir_cond_equal, result,
-         compare_to_zero ?
-           LIR_OprFact::intConst(0) : LIR_OprFact::intConst(1));
-  profile_branch(x, cond);
+  LIR_Opr expected = compare_to_zero ? LIR_OprFact::intConst(0) : LIR_OprFact::intConst(1);
+  __ cmp(lir_cond_equal, result, expected);
+  profile_branch(x, cond, result, expected);
   move_to_phi(x->state());
   __ branch(lir_cond_equal, x->tsux());
 }
@@ -1273,7 +1272,7 @@ void LIRGenerator::do_If(If* x) {
   }
 
   __ cmp(lir_cond(cond), left, right);
-  profile_branch(x, cond);
+  profile_branch(x, cond, left, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
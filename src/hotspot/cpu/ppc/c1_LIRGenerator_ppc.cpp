@@ -1092,9 +1092,9 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
                                    LIR_OprFact::illegalOpr, info_for_exception);
   } else if (x->is_invokespecial_receiver_check()) {
     assert(patching_info == NULL, "can't patch this");
-    stub = new DeoptimizeStub(info_for_exception,
-                              Deoptimization::Reason_class_check,
-                              Deoptimization::Action_none);
+    stub = new DeoptimizeStub(info_for_exception, Deoptimization::Reason_class_check,
+                              x->is_profiled_receiver_check() ? Deoptimization::Action_make_not_entrant
+                                                              : Deoptimization::Action_none);
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id, obj.result(), info_for_exception);
   }
@@ -1169,7 +1169,7 @@ void LIRGenerator::do_If(If* x) {
 
   __ cmp(lir_cond(cond), left, right);
   // Generate branch profiling. Profiling code doesn't kill flags.
-  profile_branch(x, cond);
+  profile_branch(x, cond, left, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
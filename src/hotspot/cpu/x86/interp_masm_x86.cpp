@@ -1580,6 +1580,17 @@ void InterpreterMacroAssembler::profile_taken_branch(Register mdp,
     sbbptr(bumped_count, 0);
     movptr(data, bumped_count); // Store back out
 
+    if (ProfileBranchFlips) {
+      // Count a flip if the last execution fell through: (f << 1) + 3
+      // is ((f + 1) << 1) | 1.
+      Label no_flip;
+      Address flips(mdp, in_bytes(BranchData::flips_offset()));
+      testb(flips, 1);
+      jccb(Assembler::notZero, no_flip);
+      addptr(flips, 3);
+      bind(no_flip);
+    }
+
     // The method data pointer needs to be updated to reflect the new target.
     update_mdp_by_offset(mdp, in_bytes(JumpData::displacement_offset()));
     bind(profile_continue);
@@ -1597,6 +1608,17 @@ void InterpreterMacroAssembler::profile_not_taken_branch(Register mdp) {
     // We are taking a branch.  Increment the not taken count.
     increment_mdp_data_at(mdp, in_bytes(BranchData::not_taken_offset()));
 
+    if (ProfileBranchFlips) {
+      // Count a flip if the last execution took the branch: ((f << 1) | 1) + 1
+      // is (f + 1) << 1.
+      Label no_flip;
+      Address flips(mdp, in_bytes(BranchData::flips_offset()));
+      testb(flips, 1);
+      jccb(Assembler::zero, no_flip);
+      addptr(flips, 1);
+      bind(no_flip);
+    }
+
     // The method data pointer needs to be updated to correspond to
     // the next bytecode
     update_mdp_by_constant(mdp, in_bytes(BranchData::branch_data_size()));
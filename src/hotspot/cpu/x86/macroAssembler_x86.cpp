@@ -3854,6 +3854,34 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
   LP64_ONLY( incrementl(Address(rcx, 0)) );
 #endif //PRODUCT
 
+  Label L_table_done;
+  if (UseSecondarySupersTable) {
+    // Probe the hash table of the secondary supers, if sub_klass has one.
+    // See Klass::lookup_secondary_supers_table().
+    Label L_scan, L_probe;
+    Address secondary_supers_table_addr(sub_klass, Klass::secondary_supers_table_offset());
+    cmpptr(secondary_supers_table_addr, (int32_t)NULL_WORD);
+    jccb(Assembler::equal, L_scan);
+    movptr(rdi, secondary_supers_table_addr);  // sub_klass may be rdi
+    // The home slots are the first half of the table.
+    movl(rcx, Address(rdi, Array<Klass*>::length_offset_in_bytes()));
+    shrl(rcx, 1);
+    decrementl(rcx);
+    andl(rcx, Address(rax, Klass::secondary_hash_offset()));
+    lea(rdi, Address(rdi, rcx, Address::times_ptr, Array<Klass*>::base_offset_in_bytes()));
+    // Scan [RDI] up to the next empty slot for an occurrence of RAX.
+    bind(L_probe);
+    movptr(rcx, Address(rdi, 0));
+    cmpptr(rcx, rax);
+    jccb(Assembler::equal, L_table_done);  // Z = 1
+    addptr(rdi, wordSize);
+    testptr(rcx, rcx);
+    jccb(Assembler::notZero, L_probe);
+    testptr(rax, rax);                     // Z = 0
+    jmpb(L_table_done);
+    bind(L_scan);
+  }
+
   // We will consult the secondary-super array.
   movptr(rdi, secondary_supers_addr);
   // Load the array length.  (Positive movl does right thing on LP64.)
@@ -3890,6 +3918,22 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
 
   if (L_success != &L_fallthrough) {
     jmp(*L_success);
+  } else if (UseSecondarySupersTable) {
+    jmpb(L_fallthrough);
+  }
+
+  if (UseSecondarySupersTable) {
+    // The table is not a shared cache, so a hit is not cached: that write
+    // would bounce between cores checking against different interfaces.
+    bind(L_table_done);
+    if (pushed_rdi)  pop(rdi);
+    if (pushed_rcx)  pop(rcx);
+    if (pushed_rax)  pop(rax);
+    // rdi points into the table, so it is non-zero for the AD files.
+    jcc(Assembler::notEqual, *L_failure);
+    if (L_success != &L_fallthrough) {
+      jmp(*L_success);
+    }
   }
 
 #undef IS_A_TEMP
@@ -23,10 +23,11 @@
  */
 
 #include "precompiled.hpp"
+#include "logging/log.hpp"
 #include "rdtsc_x86.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/orderAccess.hpp"
-#include "runtime/thread.inline.hpp"
+#include "runtime/os.hpp"
 #include "vm_version_ext_x86.hpp"
 
 // The following header contains the implementations of rdtsc()
@@ -63,8 +64,9 @@ static void do_time_measurements(volatile jlong& time_base,
     OrderAccess::fence();
     fstart = os::rdtsc();
 
-    // use sleep to prevent compiler from optimizing
-    JavaThread::current()->sleep(FT_SLEEP_MILLISECS);
+    // use sleep to prevent compiler from optimizing. The first timestamp
+    // may be taken by any thread, not only by JavaThreads.
+    os::naked_short_sleep(FT_SLEEP_MILLISECS);
 
     end = os::elapsed_counter();
     OrderAccess::fence();
@@ -104,6 +106,22 @@ static jlong initialize_frequency() {
   if (VM_Version_Ext::supports_tscinv_ext()) {
     // for invariant tsc platforms, take the maximum qualified cpu frequency
     tsc_freq = (double)VM_Version_Ext::maximum_qualified_cpu_frequency();
+
+    // The qualified frequency comes from the processor brand string, which
+    // may be missing. Only then fall back to measuring the rate; a short
+    // measurement is noisier than the brand string is wrong.
+    if (tsc_freq <= 0) {
+      volatile jlong time_base = 0;
+      volatile jlong time_fast = 0;
+      volatile jlong time_base_elapsed = 0;
+      volatile jlong time_fast_elapsed = 0;
+      do_time_measurements(time_base, time_fast, time_base_elapsed, time_fast_elapsed);
+      if (time_fast == 0 || time_base == 0) {
+        return 0;
+      }
+      tsc_freq = ((double)time_fast / (double)time_base) * os_freq;
+      log_info(os)("Using measured tsc frequency %.0f Hz, qualified cpu frequency is not available", tsc_freq);
+    }
     os_to_tsc_conv_factor = tsc_freq / os_freq;
   } else {
     // use measurements to estimate
@@ -2897,6 +2897,10 @@ int os::loadavg(double values[], int nelem) {
   }
 }
 
+int os::memory_pressure(double* pressure) {
+  return -1;
+}
+
 void os::pause() {
   char filename[MAX_PATH];
   if (PauseAtStartupFile && PauseAtStartupFile[0]) {
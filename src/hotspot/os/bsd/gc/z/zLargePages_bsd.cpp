@@ -32,3 +32,8 @@ void ZLargePages::pd_initialize() {
     _state = Disabled;
   }
 }
+
+size_t ZLargePages::pd_transparent_backed() {
+  // Transparent huge pages not supported
+  return 0;
+}
@@ -488,6 +488,11 @@ int CgroupSubsystem::active_processor_count() {
   result = MIN2(cpu_count, limit_count);
   log_trace(os, container)("OSContainer::active_processor_count: %d", result);
 
+  if (cpu_limit->has_value() && cpu_limit->value() != result) {
+    log_info(os, container)("Active processor count changed from %d to %d",
+                            (int)cpu_limit->value(), result);
+  }
+
   // Update cached metric to avoid re-reading container settings too often
   cpu_limit->set_value(result, OSCONTAINER_CACHE_TIMEOUT);
 
@@ -510,6 +515,10 @@ jlong CgroupSubsystem::memory_limit_in_bytes() {
     return memory_limit->value();
   }
   jlong mem_limit = read_memory_limit_in_bytes();
+  if (memory_limit->has_value() && memory_limit->value() != mem_limit) {
+    log_info(os, container)("Memory limit changed from " JLONG_FORMAT " to " JLONG_FORMAT,
+                            memory_limit->value(), mem_limit);
+  }
   // Update cached metric to avoid re-reading container settings too often
   memory_limit->set_value(mem_limit, OSCONTAINER_CACHE_TIMEOUT);
   return mem_limit;
@@ -26,6 +26,7 @@
 #define CGROUP_SUBSYSTEM_LINUX_HPP
 
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "logging/log.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -204,18 +205,21 @@ class CachedMetric : public CHeapObj<mtInternal>{
       _metric = -1;
       _next_check_counter = min_jlong;
     }
+    // Readers do not lock; a reader that sees an unexpired check counter
+    // also sees the metric stored with it.
     bool should_check_metric() {
-      return os::elapsed_counter() > _next_check_counter;
+      return os::elapsed_counter() > Atomic::load_acquire(&_next_check_counter);
     }
-    jlong value() { return _metric; }
+    bool has_value() { return Atomic::load(&_next_check_counter) != min_jlong; }
+    jlong value() { return Atomic::load(&_metric); }
     void set_value(jlong value, jlong timeout) {
-      _metric = value;
+      Atomic::store(&_metric, value);
       // Metric is unlikely to change, but we want to remain
       // responsive to configuration changes. A very short grace time
       // between re-read avoids excessive overhead during startup without
       // significantly reducing the VMs ability to promptly react to changed
       // metric config
-      _next_check_counter = os::elapsed_counter() + timeout;
+      Atomic::release_store(&_next_check_counter, os::elapsed_counter() + timeout);
     }
 };
 
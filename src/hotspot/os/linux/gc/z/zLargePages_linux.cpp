@@ -22,17 +22,108 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gcLogPrecious.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/z/zGlobals.hpp"
 #include "gc/z/zLargePages.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+
+#include <stdio.h>
+#include <unistd.h>
+
+// Sysfs file for transparent huge page on tmpfs
+#define ZFILENAME_SHMEM_ENABLED          "/sys/kernel/mm/transparent_hugepage/shmem_enabled"
+
+// Sysfs directory for the huge page pool
+#define ZDIRNAME_HUGEPAGES               "/sys/kernel/mm/hugepages"
+
+// Proc file with per mapping memory statistics
+#define ZFILENAME_PROC_SMAPS             "/proc/self/smaps"
+
+static bool read_hugepages_counter(const char* name, size_t* value) {
+  char filename[PATH_MAX];
+  os::snprintf(filename, sizeof(filename), "%s/hugepages-" SIZE_FORMAT "kB/%s",
+               ZDIRNAME_HUGEPAGES, ZGranuleSize / K, name);
+
+  FILE* const file = fopen(filename, "r");
+  if (file == NULL) {
+    return false;
+  }
+
+  const int result = fscanf(file, SIZE_FORMAT, value);
+  fclose(file);
+  return result == 1;
+}
+
+static bool huge_page_pool_can_back_initial_heap() {
+  size_t free = 0;
+  size_t reserved = 0;
+  if (!read_hugepages_counter("free_hugepages", &free) ||
+      !read_hugepages_counter("resv_hugepages", &reserved)) {
+    // Unknown, let the heap backing decide
+    return true;
+  }
+
+  const size_t available = (free - MIN2(free, reserved)) * ZGranuleSize;
+  if (available >= InitialHeapSize) {
+    return true;
+  }
+
+  log_info_p(gc, init)("Huge page pool too small for initial heap (" SIZE_FORMAT "M available, "
+                       SIZE_FORMAT "M needed)", available / M, InitialHeapSize / M);
+  return false;
+}
 
 void ZLargePages::pd_initialize() {
   if (UseLargePages) {
     if (UseTransparentHugePages) {
       _state = Transparent;
-    } else {
+    } else if (AllocateHeapAt != NULL || huge_page_pool_can_back_initial_heap()) {
       _state = Explicit;
+    } else if (access(ZFILENAME_SHMEM_ENABLED, R_OK) == 0) {
+      // Fall back to transparent huge pages, which the kernel backs with
+      // small pages when no huge pages are available
+      log_info_p(gc, init)("Falling back to transparent huge pages");
+      _state = Transparent;
+    } else {
+      log_info_p(gc, init)("Falling back to small pages");
+      _state = Disabled;
     }
   } else {
     _state = Disabled;
   }
 }
+
+size_t ZLargePages::pd_transparent_backed() {
+  FILE* const file = fopen(ZFILENAME_PROC_SMAPS, "r");
+  if (file == NULL) {
+    return 0;
+  }
+
+  // The heap is mapped in multiple views. Only count mappings in the
+  // remapped view, which covers all committed heap memory once.
+  const uintptr_t view_start = ZAddressMetadataRemapped;
+  const uintptr_t view_end = view_start + ZAddressOffsetMax;
+
+  size_t backed = 0;
+  bool in_view = false;
+  char line[256];
+
+  while (fgets(line, sizeof(line), file) != NULL) {
+    unsigned long start = 0;
+    unsigned long end = 0;
+    size_t kb = 0;
+
+    if (sscanf(line, "%lx-%lx ", &start, &end) == 2) {
+      // Start of new mapping
+      in_view = start >= view_start && end <= view_end;
+    } else if (in_view && sscanf(line, "ShmemPmdMapped: " SIZE_FORMAT " kB", &kb) == 1) {
+      backed += kb * K;
+    }
+  }
+
+  fclose(file);
+
+  return backed;
+}
@@ -2179,6 +2179,24 @@ void os::Linux::print_process_memory_info(outputStream* st) {
     st->print_cr("Could not open /proc/self/status to get process memory related information");
   }
 
+  // With THP in madvise mode, regions we madvise()d may still be backed by
+  // small pages if khugepaged has not collapsed them yet.
+  if (UseTransparentHugePages) {
+    ssize_t anonhuge = -1;
+    f = ::fopen("/proc/self/smaps_rollup", "r"); // requires kernel >= 4.14
+    if (f != NULL) {
+      while (::fgets(buf, sizeof(buf), f) != NULL) {
+        if (sscanf(buf, "AnonHugePages: " SSIZE_FORMAT " kB", &anonhuge) == 1) {
+          break;
+        }
+      }
+      fclose(f);
+    }
+    if (anonhuge != -1) {
+      st->print_cr("Backed by transparent huge pages: " SSIZE_FORMAT "K", anonhuge);
+    }
+  }
+
   // Print glibc outstanding allocations.
   // (note: there is no implementation of mallinfo for muslc)
 #ifdef __GLIBC__
@@ -5106,6 +5124,25 @@ int os::loadavg(double loadavg[], int nelem) {
   return ::getloadavg(loadavg, nelem);
 }
 
+// Memory pressure from pressure stall information (kernel >= 4.20), the
+// avg10 value of the "some" line of /proc/pressure/memory.
+int os::memory_pressure(double* pressure) {
+  FILE* f = ::fopen("/proc/pressure/memory", "r");
+  if (f == NULL) {
+    return -1;
+  }
+  char buf[256];
+  int result = -1;
+  while (::fgets(buf, sizeof(buf), f) != NULL) {
+    if (sscanf(buf, "some avg10=%lf", pressure) == 1) {
+      result = 0;
+      break;
+    }
+  }
+  fclose(f);
+  return result;
+}
+
 void os::pause() {
   char filename[MAX_PATH];
   if (PauseAtStartupFile && PauseAtStartupFile[0]) {
@@ -715,6 +715,7 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
     case os::pgc_thread:
     case os::cgc_thread:
     case os::watcher_thread:
+    case os::asynclog_thread:
       if (VMThreadStackSize > 0) stack_size = (size_t)(VMThreadStackSize * K);
       break;
     }
@@ -4591,6 +4592,10 @@ int os::loadavg(double loadavg[], int nelem) {
   return -1;
 }
 
+int os::memory_pressure(double* pressure) {
+  return -1;
+}
+
 
 // DontYieldALot=false by default: dutifully perform all yields as requested by JVM_Yield()
 bool os::dont_yield() {
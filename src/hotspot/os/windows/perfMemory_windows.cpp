@@ -1735,6 +1735,25 @@ void PerfMemory::create_memory_region(size_t size) {
     PerfDisableSharedMem = true;
     _start = create_standard_memory(size);
   }
+  else if (PerfDataPublishInterval > 0) {
+    // update the counters in standard memory and only copy snapshots to
+    // the shared memory, see PerfMemory::publish().
+    _published = create_shared_memory(size);
+    if (_published != NULL) {
+      _start = create_standard_memory(size);
+    }
+    if (_start == NULL) {
+      if (_published != NULL) {
+        delete_shared_memory(_published, size);
+        _published = NULL;
+      }
+      if (PrintMiscellaneous && Verbose) {
+        warning("Reverting to non-shared PerfMemory region.\n");
+      }
+      PerfDisableSharedMem = true;
+      _start = create_standard_memory(size);
+    }
+  }
   else {
     _start = create_shared_memory(size);
     if (_start == NULL) {
@@ -1775,6 +1794,10 @@ void PerfMemory::delete_memory_region() {
   if (PerfDisableSharedMem) {
     delete_standard_memory(start(), capacity());
   }
+  else if (_published != NULL) {
+    delete_shared_memory(_published, capacity());
+    delete_standard_memory(start(), capacity());
+  }
   else {
     delete_shared_memory(start(), capacity());
   }
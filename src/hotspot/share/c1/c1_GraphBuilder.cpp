@@ -41,6 +41,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/deoptimization.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/vm_version.hpp"
 #include "utilities/bitMap.inline.hpp"
@@ -2015,6 +2016,34 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
         }
       }
     }
+
+    if (C1InlineProfiledReceiver && !compilation()->profile_calls() &&
+        cha_monomorphic_target == NULL && exact_target == NULL && receiver != NULL &&
+        (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface) &&
+        compilation()->method()->method_data()->trap_count(Deoptimization::Reason_class_check) == 0) {
+      // If an earlier tier 3 compilation recorded a single receiver type at
+      // this site, bind the call to its target and guard the receiver with an
+      // exact type check. A miss deoptimizes and invalidates this nmethod.
+      ciCallProfile profile = method()->call_profile_at_bci(bci());
+      if (profile.morphism() == 1 && profile.has_receiver(0) &&
+          profile.receiver(0)->is_instance_klass()) {
+        ciInstanceKlass* profiled_klass = profile.receiver(0)->as_instance_klass();
+        ciMethod* profiled_target = NULL;
+        if (profiled_klass->is_initialized() && profiled_klass->is_subtype_of(actual_recv)) {
+          profiled_target = target->resolve_invoke(calling_klass, profiled_klass);
+        }
+        if (profiled_target != NULL && profiled_target->is_loaded() && !profiled_target->is_abstract()) {
+          CheckCast* c = new CheckCast(profiled_klass, receiver, copy_state_before());
+          c->set_profiled_receiver_check();
+          c->set_direct_compare(true);
+          better_receiver = append_split(c);
+          exact_target = profiled_target;
+          target = profiled_target;
+          klass = profiled_target->holder();
+          code = Bytecodes::_invokespecial;
+        }
+      }
+    }
   }
 
   if (cha_monomorphic_target != NULL) {
@@ -371,6 +371,7 @@ class Instruction: public CompilationResourceObj {
     NeedsPatchingFlag,
     ThrowIncompatibleClassChangeErrorFlag,
     InvokeSpecialReceiverCheckFlag,
+    ProfiledReceiverCheckFlag,
     ProfileMDOFlag,
     IsLinkedInBlockFlag,
     NeedsRangeCheckFlag,
@@ -1460,6 +1461,16 @@ LEAF(CheckCast, TypeCheck)
   bool is_invokespecial_receiver_check() const {
     return check_flag(InvokeSpecialReceiverCheckFlag);
   }
+  // A guard on the profiled receiver type of a virtual call. It deoptimizes
+  // like an invokespecial receiver check, but a miss also invalidates the
+  // nmethod so that the call site gets recompiled without the speculation.
+  void set_profiled_receiver_check() {
+    set_flag(InvokeSpecialReceiverCheckFlag, true);
+    set_flag(ProfiledReceiverCheckFlag, true);
+  }
+  bool is_profiled_receiver_check() const {
+    return check_flag(ProfiledReceiverCheckFlag);
+  }
 
   virtual bool needs_exception_state() const {
     return !is_invokespecial_receiver_check();
@@ -936,7 +936,16 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
+// Update the taken or not taken counter of a two-way branch. With
+// C1ProfileBranchSampleRate > 1 only about every n-th update is done, driven
+// by a countdown in the thread. A fixed countdown would alias with loops whose
+// bodies execute a multiple of n profiled branches, always sampling the same
+// branches in the same direction, so each reset draws the next countdown
+// uniformly from [n - j/2, n + j/2), with j the largest power of two <= n,
+// using a per-thread xor-shift generator. Counting down kills the condition
+// codes, so the compare of the branch is emitted again for the update and
+// after it.
+void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != NULL, "method should be set if branch is profiled");
@@ -953,6 +962,45 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
       not_taken_count_offset = t;
     }
 
+    int sample_rate = (int) C1ProfileBranchSampleRate;
+    LabelObj* L_skip = NULL;
+    if (sample_rate > 1) {
+      L_skip = new LabelObj();
+      LIR_Address* countdown_addr = new LIR_Address(getThreadPointer(),
+                                                    in_bytes(JavaThread::profile_sample_countdown_offset()),
+                                                    T_INT);
+      LIR_Opr countdown = new_register(T_INT);
+      __ move(countdown_addr, countdown);
+      __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+      __ move(countdown, countdown_addr);
+      __ cmp(lir_cond_greater, countdown, LIR_OprFact::intConst(0));
+      __ branch(lir_cond_greater, L_skip->label());
+
+      // Sampled: advance the xor-shift state and draw the next countdown.
+      int jitter = round_down_power_of_2(sample_rate);
+      LIR_Address* seed_addr = new LIR_Address(getThreadPointer(),
+                                               in_bytes(JavaThread::profile_sample_seed_offset()),
+                                               T_INT);
+      LIR_Opr seed = new_register(T_INT);
+      LIR_Opr tmp = new_register(T_INT);
+      __ move(seed_addr, seed);
+      __ move(seed, tmp);
+      __ shift_left(tmp, 13, tmp);
+      __ logical_xor(seed, tmp, seed);
+      __ move(seed, tmp);
+      __ unsigned_shift_right(tmp, 17, tmp);
+      __ logical_xor(seed, tmp, seed);
+      __ move(seed, tmp);
+      __ shift_left(tmp, 5, tmp);
+      __ logical_xor(seed, tmp, seed);
+      __ move(seed, seed_addr);
+      __ move(seed, countdown);
+      __ logical_and(countdown, LIR_OprFact::intConst(jitter - 1), countdown);
+      __ add(countdown, LIR_OprFact::intConst(sample_rate - jitter / 2), countdown);
+      __ move(countdown, countdown_addr);
+      __ cmp(lir_cond(cond), left, right);
+    }
+
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
@@ -967,9 +1015,59 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
     // Use leal instead of add to avoid destroying condition codes on x86
-    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
+    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment * sample_rate, T_INT);
     __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
     __ move(data_reg, data_addr);
+
+    if (L_skip != NULL) {
+      __ branch_destination(L_skip->label());
+      __ cmp(lir_cond(cond), left, right);
+    }
+  }
+}
+
+// Update the direction change count of a two-way branch (see
+// BranchData::flips_off_set). The update needs arithmetic which kills the
+// condition codes, so the compare of the branch is emitted again at the end.
+void LIRGenerator::profile_branch_flips(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
+  if (ProfileBranchFlips && if_instr->should_profile()) {
+    ciMethod* method = if_instr->profiled_method();
+    assert(method != NULL, "method should be set if branch is profiled");
+    ciMethodData* md = method->method_data_or_null();
+    assert(md != NULL, "Sanity");
+    ciProfileData* data = md->bci_to_data(if_instr->profiled_bci());
+    assert(data != NULL, "must have profiling data");
+    assert(data->is_BranchData(), "need BranchData for two-way branches");
+    int flips_offset = md->byte_offset_of_slot(data, BranchData::flips_offset());
+    int taken = if_instr->is_swapped() ? 0 : 1;
+
+    LIR_Opr md_reg = new_register(T_METADATA);
+    __ metadata2reg(md->constant_encoding(), md_reg);
+
+    // 1 if the branch of the bytecode is taken, 0 if it falls through.
+    LIR_Opr taken_reg = new_pointer_register();
+    __ cmove(lir_cond(cond),
+             LIR_OprFact::intptrConst(taken),
+             LIR_OprFact::intptrConst(1 - taken),
+             taken_reg, as_BasicType(if_instr->x()->type()));
+
+    LIR_Opr flips_reg = new_pointer_register();
+    LIR_Address* flips_addr = new LIR_Address(md_reg, flips_offset, flips_reg->type());
+    __ move(flips_addr, flips_reg);
+    LIR_Opr last_reg = new_pointer_register();
+    __ move(flips_reg, last_reg);
+    __ logical_and(last_reg, LIR_OprFact::intptrConst(1), last_reg);
+    LIR_Opr flip_reg = new_pointer_register();
+    __ move(last_reg, flip_reg);
+    __ logical_xor(flip_reg, taken_reg, flip_reg);
+    __ shift_left(flip_reg, 1, flip_reg);
+    // flips = (flips & ~1) + (flipped << 1) + taken
+    __ sub(flips_reg, last_reg, flips_reg);
+    __ add(flips_reg, flip_reg, flips_reg);
+    __ add(flips_reg, taken_reg, flips_reg);
+    __ move(flips_reg, flips_addr);
+
+    __ cmp(lir_cond(cond), left, right);
   }
 }
 
@@ -1629,8 +1629,18 @@ void LinearScan::sort_intervals_after_allocation() {
     return;
   }
 
-  // conventional sort-algorithm for new intervals
-  new_list->sort(interval_cmp);
+  // split children are created while the allocation walks forward, so the
+  // new intervals are almost sorted by from(). An in-place insertion sort is
+  // linear in that case and cheaper than a complete QuickSort
+  for (int i = 1; i < new_len; i++) {
+    Interval* cur_interval = new_list->at(i);
+    int cur_from = cur_interval->from();
+    int j;
+    for (j = i - 1; j >= 0 && cur_from < new_list->at(j)->from(); j--) {
+      new_list->at_put(j + 1, new_list->at(j));
+    }
+    new_list->at_put(j + 1, cur_interval);
+  }
 
   // merge old and new list (both already sorted) into one combined list
   int combined_list_len = old_len + new_len;
@@ -742,6 +742,13 @@ JRT_ENTRY(void, Runtime1::deoptimize(JavaThread* current, jint trap_request))
         if (trap_mdo != NULL) {
           trap_mdo->inc_tenure_traps();
         }
+      } else if (reason == Deoptimization::Reason_class_check) {
+        // A profiled receiver check failed. Record it so that the method is
+        // not compiled with receiver speculation again.
+        MethodData* trap_mdo = Deoptimization::get_method_data(current, method, true /*create_if_missing*/);
+        if (trap_mdo != NULL) {
+          trap_mdo->inc_trap_count(reason);
+        }
       }
     }
   }
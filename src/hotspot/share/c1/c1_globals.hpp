@@ -153,6 +153,10 @@
   product(bool, InlineSynchronizedMethods, true,                            \
           "Inline synchronized methods")                                    \
                                                                             \
+  product(bool, C1InlineProfiledReceiver, false, EXPERIMENTAL,              \
+          "Inline the single receiver type profiled at a virtual call "     \
+          "site behind a type check that deoptimizes on a miss")            \
+                                                                            \
   product(bool, InlineNIOCheckIndex, true, DIAGNOSTIC,                      \
           "Intrinsify java.nio.Buffer.checkIndex")                          \
                                                                             \
@@ -322,6 +326,12 @@
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
+  product(intx, C1ProfileBranchSampleRate, 1, EXPERIMENTAL,                 \
+          "Update the branch counters of an MDO only on about every n-th "  \
+          "profiled branch executed by a thread, at randomized intervals, " \
+          "adding n to the counter of the direction taken")                 \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
@@ -29,6 +29,8 @@
 #include "cds/dynamicArchive.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoaderData.inline.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
+#include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -40,8 +42,12 @@
 #include "memory/resourceArea.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/globals_extension.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
 #include "utilities/align.hpp"
@@ -371,6 +377,80 @@ void DynamicArchive::dump() {
   VMThread::execute(&op);
 }
 
+// Samples the number of loaded classes once a second and requests the dump of
+// AutoArchiveClassesFile after it has not changed for AutoArchiveClassesSettleTime
+// seconds. The task runs only once.
+class DynamicArchiveAutoDumpTask : public PeriodicTask {
+  static const size_t interval_ms = 1000;
+  size_t _last_count;
+  uintx  _quiet_secs;
+public:
+  DynamicArchiveAutoDumpTask() : PeriodicTask(interval_ms), _last_count(0), _quiet_secs(0) {}
+
+  void task() {
+    size_t count = ClassLoaderDataGraph::num_instance_classes();
+    if (count != _last_count) {
+      _last_count = count;
+      _quiet_secs = 0;
+    } else if (++_quiet_secs >= AutoArchiveClassesSettleTime) {
+      disenroll();
+      DynamicArchive::request_auto_dump();
+    }
+  }
+};
+
+bool DynamicArchive::_auto_dump_requested = false;
+
+void DynamicArchive::start_auto_dump_task() {
+  if (AutoArchiveClassesFile == NULL || !RecordDynamicDumpInfo) {
+    return;
+  }
+  if (!UseSharedSpaces) {
+    log_info(cds, dynamic)("AutoArchiveClassesFile ignored: base CDS archive is not loaded");
+    return;
+  }
+  if (is_mapped()) {
+    // The archive written by an earlier run was validated and mapped.
+    log_info(cds, dynamic)("Using dynamic archive %s", AutoArchiveClassesFile);
+    return;
+  }
+  DynamicArchiveAutoDumpTask* task = new DynamicArchiveAutoDumpTask();
+  task->enroll();
+}
+
+void DynamicArchive::request_auto_dump() {
+  MonitorLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+  _auto_dump_requested = true;
+  ml.notify_all();
+}
+
+bool DynamicArchive::has_auto_dump_request_and_reset() {
+  assert_lock_strong(Service_lock);
+  bool result = _auto_dump_requested;
+  _auto_dump_requested = false;
+  return result;
+}
+
+void DynamicArchive::auto_dump(JavaThread* current) {
+  JavaThread* THREAD = current; // For exception macros.
+  log_info(cds, dynamic)("Class loading has settled, writing dynamic archive %s", AutoArchiveClassesFile);
+  if (FLAG_IS_ERGO(SharedArchiveFile) && os::same_files(SharedArchiveFile, AutoArchiveClassesFile)) {
+    // Arguments set SharedArchiveFile to the stale archive that failed validation, so
+    // point it back at the base archive that is actually mapped. Otherwise dumping to
+    // the same file would be rejected by Arguments::init_shared_archive_paths().
+    FLAG_SET_ERGO(SharedArchiveFile, Arguments::GetSharedArchivePath());
+  }
+  dump(AutoArchiveClassesFile, THREAD);
+  if (HAS_PENDING_EXCEPTION) {
+    ResourceMark rm(THREAD);
+    oop message = java_lang_Throwable::message(PENDING_EXCEPTION);
+    log_warning(cds, dynamic)("Could not write dynamic archive %s: %s", AutoArchiveClassesFile,
+                              message != NULL ? java_lang_String::as_utf8_string(message)
+                                              : PENDING_EXCEPTION->klass()->external_name());
+    CLEAR_PENDING_EXCEPTION;
+  }
+}
+
 bool DynamicArchive::validate(FileMapInfo* dynamic_info) {
   assert(!dynamic_info->is_static(), "must be");
   // Check if the recorded base archive matches with the current one
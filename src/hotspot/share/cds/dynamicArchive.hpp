@@ -59,6 +59,7 @@ public:
 
 class DynamicArchive : AllStatic {
   static bool _has_been_dumped_once;
+  static bool _auto_dump_requested;
 public:
   static void dump(const char* archive_name, TRAPS);
   static void dump();
@@ -66,6 +67,14 @@ public:
   static void set_has_been_dumped_once() { _has_been_dumped_once = true; }
   static bool is_mapped() { return FileMapInfo::dynamic_info() != NULL; }
   static bool validate(FileMapInfo* dynamic_info);
+
+  // Support for AutoArchiveClassesFile: a periodic task waits for class loading
+  // to settle and then asks the ServiceThread to write the archive. The dump is a
+  // safepoint VM operation, and the ServiceThread is blocked until it completes.
+  static void start_auto_dump_task();
+  static void request_auto_dump();
+  static bool has_auto_dump_request_and_reset();
+  static void auto_dump(JavaThread* current);
 };
 #endif // INCLUDE_CDS
 #endif // SHARE_CDS_DYNAMICARCHIVE_HPP
@@ -626,6 +626,15 @@ bool ciInstanceKlass::is_leaf_type() {
   }
 }
 
+// ------------------------------------------------------------------
+// ciInstanceKlass::is_sealed
+//
+// Does this class or interface restrict its direct subtypes?
+bool ciInstanceKlass::is_sealed() {
+  assert(is_loaded(), "must be loaded");
+  GUARDED_VM_ENTRY(return get_instanceKlass()->is_sealed();)
+}
+
 // ------------------------------------------------------------------
 // ciInstanceKlass::implementor
 //
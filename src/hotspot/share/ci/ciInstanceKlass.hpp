@@ -255,6 +255,7 @@ public:
   // but consider adding to vmSymbols.hpp instead.
 
   bool is_leaf_type();
+  bool is_sealed();
   ciInstanceKlass* implementor();
 
   ciInstanceKlass* unique_implementor() {
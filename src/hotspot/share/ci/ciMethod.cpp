@@ -495,13 +495,13 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
           // we will set result._method also.
         }
         // Determine call site's morphism.
-        // The call site count is 0 with known morphism (only 1 or 2 receivers)
+        // The call site count is 0 with known morphism (all receivers fit in the rows)
         // or < 0 in the case of a type check failure for checkcast, aastore, instanceof.
         // The call site count is > 0 in the case of a polymorphic virtual call.
         if (morphism > 0 && morphism == result._limit) {
            // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           if ((morphism <  (int)call->row_limit()) ||
+               (morphism == (int)call->row_limit() && count == 0)) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
@@ -747,6 +747,39 @@ ciMethod* ciMethod::find_monomorphic_target(ciInstanceKlass* caller,
   return CURRENT_THREAD_ENV->get_method(target());
 }
 
+// ------------------------------------------------------------------
+// ciMethod::find_monomorphic_target_in_sealed
+//
+// The interface has several implementors, so the answer cannot be
+// narrowed to a single receiver class as in find_monomorphic_target.
+// Note: If caller uses a non-null result, it must inform dependencies
+// via assert_unique_concrete_method.
+ciMethod* ciMethod::find_monomorphic_target_in_sealed(ciInstanceKlass* sealed_interface) {
+  check_is_loaded();
+  assert(sealed_interface->is_interface() && sealed_interface->is_sealed(), "sanity");
+
+  if (!UseCHA || !UseSealedInterfaceCHA)  return NULL;
+
+  VM_ENTRY_MARK;
+
+  // Disable CHA for default methods for now
+  if (is_default_method()) {
+    return NULL;
+  }
+
+  Method* target = NULL;
+  {
+    MutexLocker locker(Compile_lock);
+    InstanceKlass* context = sealed_interface->get_instanceKlass();
+    target = Dependencies::find_unique_concrete_method(context, get_Method());
+  }
+  if (target == NULL || target->is_default_method()) {
+    return NULL;
+  }
+  assert(!target->is_abstract(), "not allowed");
+  return CURRENT_THREAD_ENV->get_method(target);
+}
+
 // ------------------------------------------------------------------
 // ciMethod::can_be_statically_bound
 //
@@ -289,6 +289,11 @@ class ciMethod : public ciMetadata {
                                     ciInstanceKlass* actual_receiver,
                                     bool check_access = true);
 
+  // Find the unique concrete implementation of this interface method
+  // among the implementors of a sealed interface.  Return NULL if there
+  // is none or more than one.
+  ciMethod* find_monomorphic_target_in_sealed(ciInstanceKlass* sealed_interface);
+
   // Given a known receiver klass, find the target for the call.
   // Return NULL if the call has no target or is abstract.
   ciMethod* resolve_invoke(ciKlass* caller, ciKlass* exact_receiver, bool check_access = true);
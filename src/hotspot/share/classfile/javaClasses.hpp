@@ -181,6 +181,16 @@ class java_lang_String : AllStatic {
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
+    // Four bytes per step shortens the chain of dependent multiplies. The
+    // result is the same as for the loop below (31^2, 31^3 and 31^4 folded
+    // in), which matters since it is the hash of archived symbols.
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 923521 * h
+        + 29791  * (((unsigned int) s[0]) & 0xFF)
+        + 961    * (((unsigned int) s[1]) & 0xFF)
+        + 31     * (((unsigned int) s[2]) & 0xFF)
+        +          (((unsigned int) s[3]) & 0xFF);
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
@@ -36,6 +36,7 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/padded.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
@@ -88,7 +89,7 @@ volatile bool StringTable::_needs_rehashing = false;
 OopStorage*   StringTable::_oop_storage;
 
 static size_t _current_size = 0;
-static volatile size_t _items_count = 0;
+static StripedCounter<size_t> _items_count;
 
 volatile bool _alt_hash = false;
 static uint64_t _alt_hash_seed = 0;
@@ -214,16 +215,16 @@ void StringTable::create_table() {
   _oop_storage->register_num_dead_callback(&gc_notification);
 }
 
-size_t StringTable::item_added() {
-  return Atomic::add(&_items_count, (size_t)1);
+void StringTable::item_added() {
+  _items_count.inc();
 }
 
 void StringTable::item_removed() {
-  Atomic::add(&_items_count, (size_t)-1);
+  _items_count.dec();
 }
 
 double StringTable::get_load_factor() {
-  return double(_items_count)/double(_current_size);
+  return double(_items_count.sum())/double(_current_size);
 }
 
 double StringTable::get_dead_factor(size_t num_dead) {
@@ -749,7 +750,7 @@ void StringTable::write_to_archive(const DumpedInternedStrings* dumped_interned_
   assert(HeapShared::is_heap_object_archiving_allowed(), "must be");
 
   _shared_table.reset();
-  CompactHashtableWriter writer(_items_count, ArchiveBuilder::string_stats());
+  CompactHashtableWriter writer(_items_count.sum(), ArchiveBuilder::string_stats());
 
   // Copy the interned strings into the "string space" within the java heap
   CopyToArchive copier(&writer);
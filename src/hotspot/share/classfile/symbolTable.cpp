@@ -32,6 +32,7 @@
 #include "classfile/symbolTable.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceClosure.hpp"
+#include "memory/padded.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
@@ -86,7 +87,7 @@ static size_t _symbols_removed = 0;
 static size_t _symbols_counted = 0;
 static size_t _current_size = 0;
 
-static volatile size_t _items_count = 0;
+static StripedCounter<size_t> _items_count;
 static volatile bool   _has_items_to_clean = false;
 
 
@@ -194,16 +195,16 @@ void SymbolTable::mark_has_items_to_clean()  { Atomic::store(&_has_items_to_clea
 bool SymbolTable::has_items_to_clean()       { return Atomic::load(&_has_items_to_clean); }
 
 void SymbolTable::item_added() {
-  Atomic::inc(&_items_count);
+  _items_count.inc();
 }
 
 void SymbolTable::item_removed() {
   Atomic::inc(&(_symbols_removed));
-  Atomic::dec(&_items_count);
+  _items_count.dec();
 }
 
 double SymbolTable::get_load_factor() {
-  return (double)_items_count/_current_size;
+  return (double)_items_count.sum()/_current_size;
 }
 
 size_t SymbolTable::table_size() {
@@ -604,11 +605,11 @@ void SymbolTable::copy_shared_symbol_table(GrowableArray<Symbol*>* symbols,
 }
 
 size_t SymbolTable::estimate_size_for_archive() {
-  return CompactHashtableWriter::estimate_size(int(_items_count));
+  return CompactHashtableWriter::estimate_size(int(_items_count.sum()));
 }
 
 void SymbolTable::write_to_archive(GrowableArray<Symbol*>* symbols) {
-  CompactHashtableWriter writer(int(_items_count), ArchiveBuilder::symbol_stats());
+  CompactHashtableWriter writer(int(_items_count.sum()), ArchiveBuilder::symbol_stats());
   copy_shared_symbol_table(symbols, &writer);
   if (!DynamicDumpSharedSpaces) {
     _shared_table.reset();
@@ -645,6 +645,11 @@ CodeBlob* CodeCache::find_blob(void* start) {
 CodeBlob* CodeCache::find_blob_unsafe(void* start) {
   // NMT can walk the stack before code cache is created
   if (_heaps != NULL) {
+    // All code heaps are carved out of one reservation. Stack walkers and
+    // profilers mostly look up pcs in native code, reject those right away.
+    if ((address)start < _low_bound || (address)start >= _high_bound) {
+      return NULL;
+    }
     CodeHeap* heap = get_code_heap_containing(start);
     if (heap != NULL) {
       return heap->find_blob_unsafe(start);
@@ -27,6 +27,8 @@
 #include "ci/ciEnv.hpp"
 #include "ci/ciKlass.hpp"
 #include "ci/ciMethod.hpp"
+#include "classfile/classLoaderData.hpp"
+#include "classfile/dictionary.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/vmClasses.hpp"
 #include "code/dependencies.hpp"
@@ -981,6 +983,15 @@ class AbstractClassHierarchyWalker {
   virtual Klass* find_witness_in(KlassDepChange* changes) = 0;
   virtual Klass* find_witness_anywhere(InstanceKlass* context_type) = 0;
 
+  // Interfaces with several implementors are only searched if they are sealed
+  // and the walker supports it. All implementors are then found beneath the
+  // permitted subclasses. The default reports the interface as a witness.
+  virtual Klass* find_witness_in_sealed(InstanceKlass* context_type, KlassDepChange* changes) {
+    return context_type;
+  }
+
+  static InstanceKlass* find_permitted_subclass(InstanceKlass* sealed, int index);
+
   AbstractClassHierarchyWalker(Klass* participant) : _record_witnesses(0), _num_participants(0)
 #ifdef ASSERT
   , _nof_requests(0)
@@ -1103,6 +1114,11 @@ Klass* AbstractClassHierarchyWalker::find_witness(InstanceKlass* context_type, K
       // The inherited method B.m was getting missed by the walker
       // when interface 'I' was the starting point.
       // %%% Until this is fixed more systematically, bail out.
+      // Sealed interfaces enumerate their direct implementors, which allows
+      // the walker to check the inherited methods of each of them.
+      if (UseSealedInterfaceCHA && context_type->is_sealed()) {
+        return find_witness_in_sealed(context_type, changes);
+      }
       return context_type;
     }
   }
@@ -1121,6 +1137,23 @@ Klass* AbstractClassHierarchyWalker::find_witness(InstanceKlass* context_type, K
   }
 }
 
+// Returns the loaded permitted subclass at 'index' of the sealed type, or NULL
+// if it has not been loaded yet. Permitted subclasses live in the same module,
+// and so are defined by the same loader, as the sealed type. Since classes are
+// added to the hierarchy and to the dictionary under the Compile_lock, holding
+// it guarantees that a subclass missing here is still to be checked by a
+// KlassDepChange when it loads.
+InstanceKlass* AbstractClassHierarchyWalker::find_permitted_subclass(InstanceKlass* sealed, int index) {
+  assert_locked_or_safepoint(Compile_lock);
+  Symbol* name = sealed->constants()->klass_name_at(sealed->permitted_subclasses()->at(index));
+  Dictionary* dictionary = sealed->class_loader_data()->dictionary();
+  InstanceKlass* sub = dictionary->find(dictionary->compute_hash(name), name, Handle());
+  if (sub == NULL || !sub->is_subtype_of(sealed)) {
+    return NULL;
+  }
+  return sub;
+}
+
 class ConcreteSubtypeFinder : public AbstractClassHierarchyWalker {
  private:
   bool is_witness(Klass* k);
@@ -1189,8 +1222,10 @@ class ConcreteMethodFinder : public AbstractClassHierarchyWalker {
  protected:
   virtual Klass* find_witness_in(KlassDepChange* changes);
   virtual Klass* find_witness_anywhere(InstanceKlass* context_type);
+  virtual Klass* find_witness_in_sealed(InstanceKlass* context_type, KlassDepChange* changes);
 
   bool witnessed_reabstraction_in_supers(Klass* k);
+  bool witnessed_inherited_implementation(InstanceKlass* impl);
 
  public:
   ConcreteMethodFinder(Method* m, Klass* participant = NULL) : AbstractClassHierarchyWalker(participant) {
@@ -1342,6 +1377,65 @@ Klass* ConcreteMethodFinder::find_witness_anywhere(InstanceKlass* context_type)
   return NULL;
 }
 
+// A direct implementor of an interface may inherit the implementation of the
+// method from a superclass which is not itself an implementor, as B.m for
+// C in *I.m > { A.m, C }; B.m > C. The walk beneath the implementor does not
+// see it, so look it up here and record its holder.
+bool ConcreteMethodFinder::witnessed_inherited_implementation(InstanceKlass* impl) {
+  if (impl->find_instance_method(_name, _signature, Klass::PrivateLookupMode::skip) != NULL) {
+    return false; // declared locally, checked by is_witness()
+  }
+  for (InstanceKlass* super = impl->java_super(); super != NULL; super = super->java_super()) {
+    Method* m = super->find_instance_method(_name, _signature, Klass::PrivateLookupMode::skip);
+    if (m != NULL) {
+      if (!Dependencies::is_concrete_method(m, impl)) {
+        return true; // inherited abstract method, do not reason about it
+      }
+      if (is_participant(super)) {
+        return false;
+      }
+      return record_witness(super, m);
+    }
+  }
+  return false; // only interface defaults, checked by is_witness()
+}
+
+Klass* ConcreteMethodFinder::find_witness_in_sealed(InstanceKlass* context_type, KlassDepChange* changes) {
+  if (changes != NULL) {
+    Klass* new_type = changes->new_type();
+    if (new_type->is_interface()) {
+      return new_type; // implementors of sub-interfaces are not enumerated
+    }
+    InstanceKlass* ik = InstanceKlass::cast(new_type);
+    if (ik->java_super() == NULL || !ik->java_super()->is_subtype_of(context_type)) {
+      // A new direct implementor.
+      if (witnessed_inherited_implementation(ik)) {
+        return new_type;
+      }
+    }
+    return find_witness_in(changes);
+  }
+  Array<u2>* permitted = context_type->permitted_subclasses();
+  for (int i = 0; i < permitted->length(); i++) {
+    InstanceKlass* sub = find_permitted_subclass(context_type, i);
+    if (sub == NULL) {
+      continue; // not loaded yet
+    }
+    if (sub->is_interface()) {
+      return sub;
+    }
+    if (witnessed_inherited_implementation(sub)) {
+      return sub;
+    }
+    Klass* witness = find_witness_anywhere(sub);
+    if (witness != NULL) {
+      return witness;
+    }
+  }
+  // No witness found.  The dependency remains unbroken.
+  return NULL;
+}
+
 #ifdef ASSERT
 // Assert that m is inherited into ctxk, without intervening overrides.
 // (May return true even if this is not true, in corner cases where we punt.)
@@ -27,6 +27,7 @@
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/hotMethodList.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/methodData.hpp"
 #include "oops/method.inline.hpp"
@@ -40,6 +41,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
@@ -108,6 +110,23 @@ void CompilationPolicy::compile_if_required(const methodHandle& m, TRAPS) {
       print_event(COMPILE, m(), m(), InvocationEntryBci, level);
     }
     CompileBroker::compile_method(m, InvocationEntryBci, level, methodHandle(), 0, CompileTask::Reason_MustBeCompiled, THREAD);
+  } else if (m->code() == NULL && HotMethodList::contains(m())) {
+    // The method was hot in an earlier run, start its compilation now
+    // instead of waiting for the invocation counters.
+    if (!THREAD->can_call_java() || THREAD->is_Compiler_thread() ||
+        m->method_holder()->is_not_initialized() || !can_be_compiled(m)) {
+      return;
+    }
+    CompLevel level = initial_compile_level(m);
+    if (HotMethodList::level(m()) == CompLevel_simple && CompilerConfig::is_c1_enabled() &&
+        can_be_compiled(m, CompLevel_simple)) {
+      // Tier 1 was final in the earlier run, no profile is needed.
+      level = CompLevel_simple;
+    }
+    if (PrintTieredEvents) {
+      print_event(COMPILE, m(), m(), InvocationEntryBci, level);
+    }
+    CompileBroker::compile_method(m, InvocationEntryBci, level, methodHandle(), 0, CompileTask::Reason_HotMethodList, THREAD);
   }
 }
 
@@ -613,6 +632,7 @@ void CompilationPolicy::handle_counter_overflow(Method* method) {
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
   CompileTask *max_task = NULL;
+  CompileTask *oldest_task = NULL;
   Method* max_method = NULL;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
@@ -646,9 +666,24 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       }
     }
 
+    if (oldest_task == NULL || task->time_queued() < oldest_task->time_queued()) {
+      oldest_task = task;
+    }
+
     task = next_task;
   }
 
+  if (TieredCompileTaskMaxWait > 0 && oldest_task != NULL && oldest_task != max_task) {
+    // Age the queue: a task that waited too long goes first, so that a
+    // stream of hotter methods cannot starve it. Compare in milliseconds
+    // since a large flag value would overflow when converted to ticks.
+    double waited_ms = TimeHelper::counter_to_millis(os::elapsed_counter() - oldest_task->time_queued());
+    if (waited_ms > (double)TieredCompileTaskMaxWait) {
+      max_task = oldest_task;
+      max_method = max_task->method();
+    }
+  }
+
   if (max_blocking_task != NULL) {
     // In blocking compilation mode, the CompileBroker will make
     // compilations submitted by a JVMCI compiler thread non-blocking. These
@@ -855,8 +890,13 @@ bool CompilationPolicy::is_old(Method* method) {
 }
 
 double CompilationPolicy::weight(Method* method) {
-  return (double)(method->rate() + 1) *
+  double weight = (double)(method->rate() + 1) *
     (method->invocation_count() + 1) * (method->backedge_count() + 1);
+  if (TieredCompileTaskSizeWeight) {
+    // Compile time grows with the size of the method
+    weight /= method->code_size() + 1;
+  }
+  return weight;
 }
 
 // Apply heuristics and return true if x should be compiled before y
@@ -164,6 +164,8 @@ PerfVariable*       CompileBroker::_perf_last_compile_type = NULL;
 PerfVariable*       CompileBroker::_perf_last_compile_size = NULL;
 PerfVariable*       CompileBroker::_perf_last_failed_type = NULL;
 PerfVariable*       CompileBroker::_perf_last_invalidated_type = NULL;
+PerfVariable*       CompileBroker::_perf_queued_tasks = NULL;
+PerfVariable*       CompileBroker::_perf_last_queue_wait = NULL;
 
 // Timers and counters for generating statistics
 elapsedTimer CompileBroker::_t_total_compilation;
@@ -371,6 +373,9 @@ void CompileQueue::add(CompileTask* task) {
     _last = task;
   }
   ++_size;
+  if (UsePerfData) {
+    CompileBroker::_perf_queued_tasks->inc();
+  }
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -473,6 +478,9 @@ CompileTask* CompileQueue::get() {
     save_method = methodHandle(thread, task->method());
     save_hot_method = methodHandle(thread, task->hot_method());
 
+    if (UsePerfData) {
+      CompileBroker::_perf_last_queue_wait->set_value(os::elapsed_counter() - task->time_queued());
+    }
     remove(task);
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
@@ -520,6 +528,9 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+  if (UsePerfData) {
+    CompileBroker::_perf_queued_tasks->dec(1);
+  }
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -785,6 +796,16 @@ void CompileBroker::compilation_init_phase1(Thread* THREAD) {
                                           PerfData::U_None,
                                           (jlong)CompileBroker::no_compile,
                                           CHECK);
+
+    _perf_queued_tasks =
+         PerfDataManager::create_variable(SUN_CI, "queuedTasks",
+                                          PerfData::U_Events,
+                                          CHECK);
+
+    _perf_last_queue_wait =
+         PerfDataManager::create_variable(SUN_CI, "lastQueueWait",
+                                          PerfData::U_Ticks,
+                                          CHECK);
   }
 }
 
@@ -1060,6 +1081,19 @@ void CompileBroker::init_compiler_sweeper_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+static void post_compiler_thread_budget_event(AbstractCompiler* comp, int thread_budget,
+                                              int requested, int allowed, int queue_size) {
+  EventCompilerThreadBudget event;
+  if (event.should_commit()) {
+    event.set_compiler(comp->type());
+    event.set_threadBudget(thread_budget);
+    event.set_requestedThreads(requested);
+    event.set_allowedThreads(allowed);
+    event.set_queueSize(queue_size);
+    event.commit();
+  }
+}
+
 void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
 
   julong available_memory = os::available_memory();
@@ -1070,12 +1104,31 @@ void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  // With a CPU budget, C1 and C2 share the budgeted number of threads but
+  // keep at least one thread each. Tasks beyond what the budgeted threads can
+  // handle wait in the queues, where tasks of the same method are coalesced.
+  int thread_budget = INT_MAX;
+  if (CompilerThreadCPUPercentage > 0) {
+    thread_budget = MAX2(2, (int)(os::active_processor_count() * CompilerThreadCPUPercentage / 100));
+  }
+
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
+    int c1_count = _compilers[0] != NULL ? _compilers[0]->num_compiler_threads() : 0;
     int new_c2_count = MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    if (new_c2_count > old_c2_count && new_c2_count > thread_budget - c1_count) {
+      int requested = new_c2_count;
+      new_c2_count = MAX2(old_c2_count, thread_budget - c1_count);
+      if (TraceCompilerThreads) {
+        tty->print_cr("Compiler thread CPU budget of %d threads limits %s threads to %d",
+                      thread_budget, _compilers[1]->name(), new_c2_count);
+      }
+      post_compiler_thread_budget_event(_compilers[1], thread_budget, requested, new_c2_count,
+                                        _c2_compile_queue->size());
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1126,10 +1179,21 @@ void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
 
   if (_c1_compile_queue != NULL) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
+    int c2_count = _compilers[1] != NULL ? _compilers[1]->num_compiler_threads() : 0;
     int new_c1_count = MIN4(_c1_count,
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    if (new_c1_count > old_c1_count && new_c1_count > thread_budget - c2_count) {
+      int requested = new_c1_count;
+      new_c1_count = MAX2(old_c1_count, thread_budget - c2_count);
+      if (TraceCompilerThreads) {
+        tty->print_cr("Compiler thread CPU budget of %d threads limits %s threads to %d",
+                      thread_budget, _compilers[0]->name(), new_c1_count);
+      }
+      post_compiler_thread_budget_event(_compilers[0], thread_budget, requested, new_c1_count,
+                                        _c1_compile_queue->size());
+    }
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -140,6 +140,7 @@ public:
 class CompileBroker: AllStatic {
  friend class Threads;
  friend class CompileTaskWrapper;
+ friend class CompileQueue;
 
  public:
   enum {
@@ -202,6 +203,8 @@ class CompileBroker: AllStatic {
   static PerfVariable*       _perf_last_compile_size;
   static PerfVariable*       _perf_last_failed_type;
   static PerfVariable*       _perf_last_invalidated_type;
+  static PerfVariable*       _perf_queued_tasks;
+  static PerfVariable*       _perf_last_queue_wait;
 
   // Timers and counters for generating statistics
   static elapsedTimer _t_total_compilation;
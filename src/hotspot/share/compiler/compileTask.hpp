@@ -54,6 +54,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
       Reason_Whitebox,         // Whitebox API
       Reason_MustBeCompiled,   // Used for -Xcomp or AlwaysCompileLoopMethods (see CompilationPolicy::must_be_compiled())
       Reason_Bootstrap,        // JVMCI bootstrap
+      Reason_HotMethodList,    // -XX:HotMethodListFile (see HotMethodList)
       Reason_Count
   };
 
@@ -66,7 +67,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
       "replay",
       "whitebox",
       "must_be_compiled",
-      "bootstrap"
+      "bootstrap",
+      "hot_method_list"
     };
     return reason_names[compile_reason];
   }
@@ -161,6 +163,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
 
   void         mark_complete()                   { _is_complete = true; }
   void         mark_success()                    { _is_success = true; }
+  jlong        time_queued() const               { return _time_queued; }
   void         mark_started(jlong time)          { _time_started = time; }
 
   int          comp_level()                      { return _comp_level;}
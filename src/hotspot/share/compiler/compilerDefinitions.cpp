@@ -606,6 +606,10 @@ void CompilerConfig::ergo_initialize() {
     // blind guess
     LoopStripMiningIterShortLoop = LoopStripMiningIter / 10;
   }
+  if (UsePolymorphicInlining && FLAG_IS_DEFAULT(TypeProfileWidth)) {
+    // Record enough receivers per call site to fill the inlined chain
+    FLAG_SET_ERGO(TypeProfileWidth, MAX2(TypeProfileWidth, PolymorphicInlineLimit));
+  }
 #endif // COMPILER2
 }
 
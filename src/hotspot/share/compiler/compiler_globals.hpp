@@ -238,6 +238,16 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskMaxWait, 0, EXPERIMENTAL,                  \
+          "Select a compile task that has been queued for longer than "     \
+          "this many milliseconds before tasks of hotter methods. "         \
+          "0 means tasks are selected by rate only")                        \
+          range(0, max_intx)                                                \
+                                                                            \
+  product(bool, TieredCompileTaskSizeWeight, false, EXPERIMENTAL,           \
+          "Divide the selection weight of a queued method by its bytecode " \
+          "size, so that cheap compilations are not stuck behind big ones") \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -290,6 +300,14 @@
   product(ccstr, CompileCommandFile, NULL,                                  \
           "Read compiler commands from this file [.hotspot_compiler]")      \
                                                                             \
+  product(ccstr, HotMethodListFile, NULL, EXPERIMENTAL,                     \
+          "Submit the methods in this list (see DumpHotMethodList) for "    \
+          "compilation when their first call is linked")                    \
+                                                                            \
+  product(ccstr, DumpHotMethodList, NULL, EXPERIMENTAL,                     \
+          "At exit, write the methods compiled at the highest tier to "     \
+          "this file")                                                      \
+                                                                            \
   product(ccstr, CompilerDirectivesFile, NULL, DIAGNOSTIC,                  \
           "Read compiler directives from this file")                        \
                                                                             \
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/compilationPolicy.hpp"
+#include "compiler/compiler_globals.hpp"
+#include "compiler/hotMethodList.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+class HotMethodKey {
+ public:
+  Symbol* _holder;
+  Symbol* _name;
+  Symbol* _signature;
+
+  HotMethodKey() : _holder(NULL), _name(NULL), _signature(NULL) {}
+  HotMethodKey(Symbol* holder, Symbol* name, Symbol* signature) :
+    _holder(holder), _name(name), _signature(signature) {}
+
+  static unsigned hash(const HotMethodKey& k) {
+    return k._holder->identity_hash() ^
+           (k._name->identity_hash() * 31) ^
+           (k._signature->identity_hash() * 37);
+  }
+
+  static bool equals(const HotMethodKey& a, const HotMethodKey& b) {
+    return a._holder == b._holder && a._name == b._name && a._signature == b._signature;
+  }
+};
+
+typedef ResourceHashtable<HotMethodKey, int,
+                          HotMethodKey::hash, HotMethodKey::equals,
+                          1009, ResourceObj::C_HEAP, mtCompiler> HotMethodTable;
+
+// Written once during VM initialization and only read afterwards.
+static HotMethodTable* _hot_methods = NULL;
+
+void HotMethodList::load(const char* file) {
+  FILE* stream = os::fopen(file, "rt");
+  if (stream == NULL) {
+    log_warning(jit, compilation)("Cannot open hot method list %s", file);
+    return;
+  }
+
+  _hot_methods = new (ResourceObj::C_HEAP, mtCompiler) HotMethodTable();
+  int count = 0;
+  char line[1024];
+  char holder[1024];
+  char name[1024];
+  char signature[1024];
+  int level;
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    if (line[0] == '#') {
+      continue;
+    }
+    int fields = sscanf(line, "%1023s %1023s %1023s %d", holder, name, signature, &level);
+    if (fields < 3) {
+      continue;
+    }
+    if (fields == 3 || level < CompLevel_simple || level > CompLevel_full_optimization) {
+      level = CompLevel_full_optimization;
+    }
+    // The symbols are permanent since the table is never freed.
+    HotMethodKey key(SymbolTable::new_permanent_symbol(holder),
+                     SymbolTable::new_permanent_symbol(name),
+                     SymbolTable::new_permanent_symbol(signature));
+    if (_hot_methods->put(key, level)) {
+      count++;
+    }
+  }
+  fclose(stream);
+  log_info(jit, compilation)("Loaded %d methods from hot method list %s", count, file);
+}
+
+bool HotMethodList::contains(const Method* m) {
+  return level(m) != CompLevel_none;
+}
+
+CompLevel HotMethodList::level(const Method* m) {
+  if (_hot_methods == NULL) {
+    return CompLevel_none;
+  }
+  HotMethodKey key(m->method_holder()->name(), m->name(), m->signature());
+  int* level = _hot_methods->get(key);
+  return level != NULL ? (CompLevel)*level : CompLevel_none;
+}
+
+void HotMethodList::dump(const char* file) {
+  fileStream fs(file, "w");
+  if (!fs.is_open()) {
+    log_warning(jit, compilation)("Cannot create hot method list %s", file);
+    return;
+  }
+  fs.print_cr("# Methods compiled at their final tier, see -XX:HotMethodListFile");
+
+  CompLevel highest_level = CompilationPolicy::highest_compile_level();
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  NMethodIterator iter(NMethodIterator::only_alive_and_not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    // Tier 1 is final for trivial methods and for methods C2 cannot
+    // compile. OSR compilations are listed as well, their method is hot
+    // too. The list may contain a method twice, loading it drops the
+    // duplicates.
+    int level = nm->comp_level();
+    if ((level != highest_level && level != CompLevel_simple) || !nm->is_java_method()) {
+      continue;
+    }
+    Method* m = nm->method();
+    ResourceMark rm;
+    fs.print_cr("%s %s %s %d",
+                m->method_holder()->name()->as_C_string(),
+                m->name()->as_C_string(),
+                m->signature()->as_C_string(),
+                level);
+  }
+}
+
+void hotMethodList_init() {
+  if (HotMethodListFile != NULL) {
+    HotMethodList::load(HotMethodListFile);
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_HOTMETHODLIST_HPP
+#define SHARE_COMPILER_HOTMETHODLIST_HPP
+
+#include "compiler/compilerDefinitions.hpp"
+#include "memory/allocation.hpp"
+
+class Method;
+
+// A list of methods that reached their final compilation tier in an earlier
+// run of the application. The list is written at exit with
+// -XX:DumpHotMethodList=<file>, one "<holder> <name> <signature> <level>"
+// line per method. When it is read back with -XX:HotMethodListFile=<file>,
+// the listed methods are submitted for compilation when their first call is
+// linked, instead of after the interpreter invocation thresholds. Methods
+// that ended at tier 1 go there directly, skipping the profiled tier.
+class HotMethodList : AllStatic {
+ public:
+  static void load(const char* file);
+  static void dump(const char* file);
+
+  // Is m on the loaded list?
+  static bool contains(const Method* m);
+  // The level m was compiled at in the earlier run, or CompLevel_none.
+  static CompLevel level(const Method* m);
+};
+
+void hotMethodList_init();
+
+#endif // SHARE_COMPILER_HOTMETHODLIST_HPP
@@ -36,6 +36,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1CollectorState.hpp"
+#include "gc/g1/g1ConcurrentPreTouchTask.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
@@ -72,10 +73,11 @@
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/g1/heapRegionSet.inline.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
+#include "gc/shared/concurrentGCThreadBudget.hpp"
 #include "gc/shared/gcBehaviours.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcId.hpp"
-#include "gc/shared/gcLocker.hpp"
+#include "gc/shared/gcLocker.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/generationSpec.hpp"
@@ -136,7 +138,14 @@ class RedirtyLoggedCardTableEntryClosure : public G1CardTableEntryClosure {
 
   bool will_become_free(HeapRegion* hr) const {
     // A region will be freed by free_collection_set if the region is in the
-    // collection set and has not had an evacuation failure.
+    // collection set and has not had an evacuation failure, or by eager
+    // reclaim if it belongs to a humongous object that is still a candidate.
+    if (hr->is_humongous()) {
+      HeapRegion* start = hr->humongous_start_region();
+      return G1EagerReclaimHumongousObjects &&
+             _g1h->is_humongous_reclaim_candidate(start->hrm_index()) &&
+             start->rem_set()->is_empty();
+    }
     return _g1h->is_in_cset(hr) && !hr->evacuation_failed();
   }
 
@@ -166,6 +175,11 @@ void G1RegionMappingChangedListener::on_commit(uint start_idx, size_t num_region
   // The from card cache is not the memory that is actually committed. So we cannot
   // take advantage of the zero_filled parameter.
   reset_from_card_cache(start_idx, num_regions);
+
+  G1ConcurrentPreTouchTask* pretouch_task = G1CollectedHeap::heap()->pretouch_task();
+  if (pretouch_task != NULL) {
+    pretouch_task->add_regions(start_idx, num_regions);
+  }
 }
 
 Tickspan G1CollectedHeap::run_task_timed(AbstractGangTask* task) {
@@ -1405,6 +1419,7 @@ G1CollectedHeap::G1CollectedHeap() :
   CollectedHeap(),
   _service_thread(NULL),
   _periodic_gc_task(NULL),
+  _pretouch_task(NULL),
   _workers(NULL),
   _card_table(NULL),
   _collection_pause_end(Ticks::now()),
@@ -1677,6 +1692,12 @@ jint G1CollectedHeap::initialize() {
 
   _numa->set_region_info(HeapRegion::GrainBytes, page_size);
 
+  if (G1ConcurrentPreTouch && !AlwaysPreTouch) {
+    // Created before the initial expansion so that it records the initially
+    // committed regions too.
+    _pretouch_task = new G1ConcurrentPreTouchTask(max_reserved_regions(), page_size);
+  }
+
   // Create the G1ConcurrentMark data structure and thread.
   // (Must do this late, so that "max_[reserved_]regions" is defined.)
   _cm = new G1ConcurrentMark(this, prev_bitmap_storage, next_bitmap_storage);
@@ -1691,6 +1712,10 @@ jint G1CollectedHeap::initialize() {
   // Perform any initialization actions delegated to the policy.
   policy()->init(this, &_collection_set);
 
+  // Set up the budget shared by the concurrent background threads before
+  // any of them starts.
+  ConcurrentGCThreadBudget::initialize();
+
   jint ecode = initialize_concurrent_refinement();
   if (ecode != JNI_OK) {
     return ecode;
@@ -1708,6 +1733,11 @@ jint G1CollectedHeap::initialize() {
   _periodic_gc_task = new G1PeriodicGCTask("Periodic GC Task");
   _service_thread->register_task(_periodic_gc_task);
 
+  // Start pretouching the regions committed so far in the background.
+  if (_pretouch_task != NULL) {
+    _pretouch_task->register_with(_service_thread);
+  }
+
   {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
     dcqs.set_process_cards_threshold(concurrent_refine()->yellow_zone());
@@ -2360,6 +2390,24 @@ bool G1CollectedHeap::is_archived_object(oop object) const {
   return object != NULL && heap_region_containing(object)->is_archive();
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  if (heap_region_containing(obj)->is_pinned()) {
+    return obj;
+  }
+  // Objects outside of pinned regions may move in a GC that runs while
+  // lock_critical() blocks, so keep the object in a handle and resolve it
+  // again once the GCLocker is held.
+  Handle h(thread, obj);
+  GCLocker::lock_critical(thread);
+  return h();
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  if (!heap_region_containing(obj)->is_pinned()) {
+    GCLocker::unlock_critical(thread);
+  }
+}
+
 class PrintRegionClosure: public HeapRegionClosure {
   outputStream* _st;
 public:
@@ -2616,6 +2664,15 @@ void G1CollectedHeap::gc_epilogue(bool full) {
   _collection_pause_end = Ticks::now();
 }
 
+HeapRegion* G1CollectedHeap::free_region_at_or_null(uint index) const {
+  assert(Heap_lock->owned_by_self(), "must hold the Heap_lock");
+  if (!_hrm.is_available(index)) {
+    return NULL;
+  }
+  HeapRegion* hr = region_at(index);
+  return hr->is_free() ? hr : NULL;
+}
+
 uint G1CollectedHeap::uncommit_regions(uint region_limit) {
   return _hrm.uncommit_inactive_regions(region_limit);
 }
@@ -2958,6 +3015,7 @@ void G1CollectedHeap::do_collection_pause_at_safepoint_helper(double target_paus
     uint active_workers = WorkerPolicy::calc_active_workers(workers()->total_workers(),
                                                             workers()->active_workers(),
                                                             Threads::number_of_non_daemon_threads());
+    active_workers = policy()->calc_evacuation_workers(active_workers);
     active_workers = workers()->update_active_workers(active_workers);
     log_info(gc,task)("Using %u workers of %u for evacuation", active_workers, workers()->total_workers());
 
@@ -3563,10 +3621,13 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
+      // A humongous objArray induces remembered set entries on other
+      // regions.  These become stale when the object is reclaimed, which
+      // the remembered set scan already tolerates as it does for any
+      // other freed region: cards are filtered by the scan top of the
+      // region they are in.  Since objArrays may be on the mark stack or
+      // referenced from SATB buffers, we only nominate them while no
+      // concurrent mark or remembered set rebuild is in progress.
       //
       // We also treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
@@ -3578,7 +3639,12 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
 
-      return obj->is_typeArray() &&
+      if (obj->is_typeArray()) {
+        return _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+      return G1EagerReclaimHumongousObjArrays &&
+             obj->is_objArray() &&
+             !_g1h->collector_state()->mark_or_rebuild_in_progress() &&
              _g1h->is_potential_eager_reclaim_candidate(region);
     }
 
@@ -4394,10 +4460,10 @@ public:
     // are completely up-to-date wrt to references to the humongous object.
     //
     // Other implementation considerations:
-    // - never consider object arrays at this time because they would pose
-    // considerable effort for cleaning up the the remembered sets. This is
-    // required because stale remembered sets might reference locations that
-    // are currently allocated into.
+    // - object arrays are only nominated outside of concurrent mark and
+    // remembered set rebuild (see G1PrepareRegionsClosure), and any
+    // remembered set entries they induced on other regions are left
+    // as stale entries.
     uint region_idx = r->hrm_index();
     if (!g1h->is_humongous_reclaim_candidate(region_idx) ||
         !r->rem_set()->is_empty()) {
@@ -4414,9 +4480,10 @@ public:
       return false;
     }
 
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
-              PTR_FORMAT " is not.", p2i(r->bottom()));
+    guarantee(obj->is_typeArray() ||
+              (obj->is_objArray() && !g1h->collector_state()->mark_or_rebuild_in_progress()),
+              "Only eagerly reclaiming type arrays and object arrays outside of marking is supported, "
+              "but the object " PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Dead humongous region %u object size " SIZE_FORMAT " start " PTR_FORMAT " with remset " SIZE_FORMAT " code roots " SIZE_FORMAT " is marked %d reclaim candidate %d type array %d",
                              region_idx,
@@ -79,6 +79,7 @@ class G1CollectionSet;
 class G1Policy;
 class G1HotCardCache;
 class G1RemSet;
+class G1ConcurrentPreTouchTask;
 class G1ServiceTask;
 class G1ServiceThread;
 class G1ConcurrentMark;
@@ -156,6 +157,7 @@ class G1CollectedHeap : public CollectedHeap {
 private:
   G1ServiceThread* _service_thread;
   G1ServiceTask* _periodic_gc_task;
+  G1ConcurrentPreTouchTask* _pretouch_task;
 
   WorkGang* _workers;
   G1CardTable* _card_table;
@@ -582,6 +584,12 @@ public:
   uint uncommit_regions(uint region_limit);
   bool has_uncommittable_regions();
 
+  // Background pretouch of newly committed regions, NULL if disabled.
+  G1ConcurrentPreTouchTask* pretouch_task() const { return _pretouch_task; }
+  // Returns the region at the given index if it is committed and free,
+  // NULL otherwise. Must hold the Heap_lock.
+  HeapRegion* free_region_at_or_null(uint index) const;
+
   G1NUMA* numa() const { return _numa; }
 
   // Expand the garbage-first heap by at least the given size (in bytes!).
@@ -1435,6 +1443,13 @@ public:
 
   virtual bool is_archived_object(oop object) const;
 
+  // Objects in humongous and archive regions are never moved, so JNI
+  // critical regions on them do not need to lock out GC. Other objects
+  // still use the GCLocker.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // The methods below are here for convenience and dispatch the
   // appropriate method depending on value of the given VerifyOption
   // parameter. The values for that parameter, and their meanings,
@@ -26,8 +26,10 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/g1Policy.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/space.inline.hpp"
+#include "logging/log.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/quickSort.hpp"
 
@@ -185,7 +187,9 @@ class G1BuildCandidateRegionsTask : public AbstractGangTask {
       // We will skip any region that's currently used as an old GC
       // alloc region (we should not consider those for collection
       // before we fill them up).
-      if (should_add(r) && !G1CollectedHeap::heap()->is_old_gc_alloc_region(r)) {
+      if (should_add(r) &&
+          !G1CollectedHeap::heap()->is_old_gc_alloc_region(r) &&
+          G1CollectionSetChooser::region_remset_cost_low_enough_for_evac(r)) {
         add_region(r);
       } else if (r->is_old()) {
         // Keep remembered sets for humongous regions, otherwise clean out remembered
@@ -257,6 +261,22 @@ bool G1CollectionSetChooser::should_add(HeapRegion* hr) {
          hr->rem_set()->is_complete();
 }
 
+bool G1CollectionSetChooser::region_remset_cost_low_enough_for_evac(HeapRegion* hr) {
+  if (G1MixedGCRemSetCostThresholdPercent == 0) {
+    return true;
+  }
+  G1Policy* p = G1CollectedHeap::heap()->policy();
+  double const threshold_ms = p->max_pause_time_ms() * G1MixedGCRemSetCostThresholdPercent / 100.0;
+  double const predicted_ms = p->predict_region_non_copy_time_ms(hr, false /* for_young_gc */);
+  if (predicted_ms > threshold_ms) {
+    log_debug(gc, ergo, cset)("Skip region %u as candidate: predicted remembered set processing time %1.2fms "
+                              "(remset occupancy " SIZE_FORMAT ") exceeds %1.2fms",
+                              hr->hrm_index(), predicted_ms, hr->rem_set()->occupied(), threshold_ms);
+    return false;
+  }
+  return true;
+}
+
 // Closure implementing early pruning (removal) of regions meeting the
 // G1HeapWastePercent criteria. That is, either until _max_pruned regions were
 // removed (for forward progress in evacuation) or the waste accumulated by the
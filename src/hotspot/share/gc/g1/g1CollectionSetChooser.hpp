@@ -51,6 +51,13 @@ public:
     return live_bytes < mixed_gc_live_threshold_bytes();
   }
 
+  // Returns whether the predicted time to merge and scan the remembered set of
+  // the given region is within G1MixedGCRemSetCostThresholdPercent of the pause
+  // time goal. Regions with little live data but a huge remembered set would
+  // otherwise be ranked as efficient but exceed the pause time goal whenever
+  // they are collected.
+  static bool region_remset_cost_low_enough_for_evac(HeapRegion* hr);
+
   // Determine whether to add the given region to the collection set candidates or
   // not. Currently, we skip pinned regions and regions whose live
   // bytes are over the threshold. Humongous regions may be reclaimed during cleanup.
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1ConcurrentPreTouchTask.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ticks.hpp"
+
+G1ConcurrentPreTouchTask::G1ConcurrentPreTouchTask(uint max_regions, size_t page_size) :
+    G1ServiceTask("G1 Concurrent PreTouch Task"),
+    _committed(max_regions, mtGC),
+    _has_committed(false),
+    _untouched(max_regions, mtGC),
+    _untouched_limit(0),
+    _page_size(page_size),
+    _summary_duration(),
+    _summary_region_count(0) { }
+
+void G1ConcurrentPreTouchTask::add_regions(uint start_idx, size_t num_regions) {
+  _committed.par_set_range(start_idx, start_idx + num_regions, BitMap::unknown_range);
+  // Publish the bits before the flag; the task clears the flag before
+  // looking at the bits, so it never misses a range.
+  Atomic::release_store(&_has_committed, true);
+}
+
+void G1ConcurrentPreTouchTask::register_with(G1ServiceThread* service_thread) {
+  // The task is scheduled right away and keeps rescheduling itself.
+  service_thread->register_task(this);
+}
+
+void G1ConcurrentPreTouchTask::take_committed_regions() {
+  assert(Heap_lock->owned_by_self(), "must hold the Heap_lock");
+  if (!Atomic::load_acquire(&_has_committed) || !Atomic::cmpxchg(&_has_committed, true, false)) {
+    return;
+  }
+  BitMap::idx_t index = _committed.get_next_one_offset(0);
+  while (index < _committed.size()) {
+    _committed.par_clear_bit(index);
+    _untouched.set_bit(index);
+    _untouched_limit = MAX2(_untouched_limit, (uint)index + 1);
+    index = _committed.get_next_one_offset(index + 1);
+  }
+}
+
+bool G1ConcurrentPreTouchTask::has_untouched_regions() const {
+  return _untouched_limit > 0;
+}
+
+uint G1ConcurrentPreTouchTask::claim_untouched_region() {
+  assert(has_untouched_regions(), "precondition");
+  uint index = _untouched_limit - 1;
+  _untouched.clear_bit(index);
+  // Move the limit down to the next untouched region.
+  while (_untouched_limit > 0 && !_untouched.at(_untouched_limit - 1)) {
+    _untouched_limit--;
+  }
+  return index;
+}
+
+bool G1ConcurrentPreTouchTask::pretouch_region(uint index) {
+  assert(Heap_lock->owned_by_self(), "must hold the Heap_lock");
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  // Regions that have been allocated since they were committed are
+  // touched by their users anyway, and regions that have been uncommitted
+  // again will be recorded anew when committed.
+  HeapRegion* hr = g1h->free_region_at_or_null(index);
+  if (hr == NULL) {
+    return false;
+  }
+  os::pretouch_memory(hr->bottom(), hr->end(), _page_size);
+  return true;
+}
+
+void G1ConcurrentPreTouchTask::report_summary() {
+  log_debug(gc, heap)("Concurrent PreTouch Summary: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                      byte_size_in_proper_unit(_summary_region_count * HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(_summary_region_count * HeapRegion::GrainBytes),
+                      _summary_region_count,
+                      _summary_duration.seconds() * 1000);
+}
+
+void G1ConcurrentPreTouchTask::clear_summary() {
+  _summary_duration = Tickspan();
+  _summary_region_count = 0;
+}
+
+void G1ConcurrentPreTouchTask::execute() {
+  // Translate the size limit into a number of regions. This cannot be a
+  // compile time constant because G1HeapRegionSize is set ergonomically.
+  uint const region_limit = MAX2((uint)(PreTouchSizeLimit / HeapRegion::GrainBytes), 1u);
+
+  // Polling while idle does not need the Heap_lock; only this task
+  // changes _untouched.
+  if (!has_untouched_regions() && !Atomic::load_acquire(&_has_committed)) {
+    schedule(PreTouchTaskIdleDelayMs);
+    return;
+  }
+
+  Ticks start = Ticks::now();
+  uint touched = 0;
+  for (uint claimed = 0; claimed < region_limit; claimed++) {
+    // Holding the Heap_lock keeps the region on the free list, as neither
+    // mutators nor GC pauses can take it while pretouching. The lock is
+    // released after every region to avoid stalling allocation.
+    MutexLocker ml(Heap_lock);
+    take_committed_regions();
+    if (!has_untouched_regions()) {
+      // Nothing more to do; report any work done since the last time and
+      // poll for newly committed regions at a lower rate.
+      if (_summary_region_count + touched > 0) {
+        _summary_duration += Ticks::now() - start;
+        _summary_region_count += touched;
+        report_summary();
+        clear_summary();
+      }
+      schedule(PreTouchTaskIdleDelayMs);
+      return;
+    }
+    if (pretouch_region(claim_untouched_region())) {
+      touched++;
+    }
+  }
+  Tickspan pretouch_time = Ticks::now() - start;
+  _summary_duration += pretouch_time;
+  _summary_region_count += touched;
+
+  log_trace(gc, heap)("Concurrent PreTouch: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                      byte_size_in_proper_unit(touched * HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(touched * HeapRegion::GrainBytes),
+                      touched,
+                      pretouch_time.seconds() * 1000);
+
+  // Delay to avoid starving application.
+  schedule(PreTouchTaskDelayMs);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CONCURRENTPRETOUCHTASK_HPP
+#define SHARE_GC_G1_G1CONCURRENTPRETOUCHTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "utilities/bitMap.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+
+// Background alternative to AlwaysPreTouch. Newly committed regions are
+// recorded as untouched and the memory of those still on the free list is
+// touched on the service thread, one region at a time while holding the
+// Heap_lock. Regions are touched from the highest index downwards, the end of
+// the free list young regions are taken from, so that allocation prefers
+// regions that have already been touched.
+//
+// Regions are committed with various locks held, so recording them must
+// neither take locks nor touch state owned by the task. They are only marked
+// in a separate bitmap, which the task picks up on its next execution; the
+// task reschedules itself and polls for new regions at a lower rate while
+// there is nothing to touch.
+class G1ConcurrentPreTouchTask : public G1ServiceTask {
+  // Each execution of the pretouch task is limited to touch at most 128M.
+  static const size_t PreTouchSizeLimit = 128 * M;
+  // The delay between two pretouch task executions.
+  static const uint PreTouchTaskDelayMs = 10;
+  // The delay between polls for newly committed regions when idle.
+  static const uint PreTouchTaskIdleDelayMs = 100;
+
+  // Regions committed since the task last looked, and whether there are
+  // any. Set concurrently by add_regions() and taken by the task.
+  CHeapBitMap _committed;
+  volatile bool _has_committed;
+
+  // Committed regions that have not been touched yet. Only accessed by the
+  // task while holding the Heap_lock.
+  CHeapBitMap _untouched;
+  // All set bits in _untouched are below this index.
+  uint _untouched_limit;
+
+  // Page size used for pretouching the heap.
+  size_t _page_size;
+
+  // Members to keep a summary of the current concurrent pretouch
+  // work. Used for printing when no more work is available.
+  Tickspan _summary_duration;
+  uint _summary_region_count;
+
+  // Moves the regions recorded by add_regions() into _untouched.
+  void take_committed_regions();
+  bool has_untouched_regions() const;
+  // Returns the index of the highest untouched region and removes it
+  // from the set of untouched regions.
+  uint claim_untouched_region();
+  // Pretouches the given region if it is still committed and free.
+  bool pretouch_region(uint index);
+
+  void report_summary();
+  void clear_summary();
+
+public:
+  G1ConcurrentPreTouchTask(uint max_regions, size_t page_size);
+
+  // Record the given newly committed regions for the task to pick up. Lock
+  // free, and may be called concurrently.
+  void add_regions(uint start_idx, size_t num_regions);
+
+  // Register with the service thread; starts pretouching any regions
+  // committed so far.
+  void register_with(G1ServiceThread* service_thread);
+
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1CONCURRENTPRETOUCHTASK_HPP
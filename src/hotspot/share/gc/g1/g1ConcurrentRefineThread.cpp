@@ -28,6 +28,7 @@
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
+#include "gc/shared/concurrentGCThreadBudget.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "logging/log.hpp"
 #include "runtime/atomic.hpp"
@@ -113,6 +114,9 @@ void G1ConcurrentRefineThread::run_service() {
     G1ConcurrentRefineStats total_stats; // Accumulate over activation.
 
     {
+      // Wait for a slot of the concurrent GC thread budget before joining
+      // the suspendible thread set.
+      ConcurrentGCThreadBudgetSlot budget_slot(ConcurrentGCThreadBudget::High);
       SuspendibleThreadSetJoiner sts_join;
 
       while (!should_terminate()) {
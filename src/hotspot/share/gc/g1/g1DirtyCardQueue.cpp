@@ -105,11 +105,29 @@ void G1DirtyCardQueueSet::enqueue(G1DirtyCardQueue& queue,
 
 void G1DirtyCardQueueSet::handle_zero_index(G1DirtyCardQueue& queue) {
   assert(queue.index() == 0, "precondition");
-  BufferNode* old_node = exchange_buffer_with_new(queue);
-  if (old_node != nullptr) {
-    G1ConcurrentRefineStats* stats = queue.refinement_stats();
-    stats->inc_dirtied_cards(buffer_size());
-    handle_completed_buffer(old_node, stats);
+  void** buffer = queue.buffer();
+  if (buffer == nullptr) {
+    install_new_buffer(queue);
+    return;
+  }
+  // The old buffer is handed over to the completed queue, so detach it from
+  // the queue first.
+  BufferNode* old_node = BufferNode::make_node_from_buffer(buffer, queue.index());
+  queue.set_buffer(nullptr);
+
+  G1ConcurrentRefineStats* stats = queue.refinement_stats();
+  stats->inc_dirtied_cards(buffer_size());
+  BufferNode* refined_node = handle_completed_buffer(old_node, stats);
+
+  if (refined_node != nullptr) {
+    // Reuse the buffer the mutator just refined. This avoids a round trip
+    // through the shared allocator free list, which is contended by all
+    // mutator and refinement threads under high card dirtying rates.
+    refined_node->set_index(buffer_size());
+    queue.set_buffer(BufferNode::make_buffer_from_node(refined_node));
+    queue.set_index(buffer_size());
+  } else {
+    install_new_buffer(queue);
   }
 }
 
@@ -499,22 +517,22 @@ void G1DirtyCardQueueSet::handle_refined_buffer(BufferNode* node,
   }
 }
 
-void G1DirtyCardQueueSet::handle_completed_buffer(BufferNode* new_node,
-                                                  G1ConcurrentRefineStats* stats) {
+BufferNode* G1DirtyCardQueueSet::handle_completed_buffer(BufferNode* new_node,
+                                                         G1ConcurrentRefineStats* stats) {
   enqueue_completed_buffer(new_node);
 
   // No need for mutator refinement if number of cards is below limit.
   if (Atomic::load(&_num_cards) <= Atomic::load(&_padded_max_cards)) {
-    return;
+    return NULL;
   }
 
   // Only Java threads perform mutator refinement.
   if (!Thread::current()->is_Java_thread()) {
-    return;
+    return NULL;
   }
 
   BufferNode* node = get_completed_buffer();
-  if (node == NULL) return;     // Didn't get a buffer to process.
+  if (node == NULL) return NULL; // Didn't get a buffer to process.
 
   // Refine cards in buffer.
 
@@ -523,7 +541,14 @@ void G1DirtyCardQueueSet::handle_completed_buffer(BufferNode* new_node,
   _free_ids.release_par_id(worker_id); // release the id
 
   // Deal with buffer after releasing id, to let another thread use id.
+  if (fully_processed) {
+    assert(node->index() == buffer_size(),
+           "Buffer not fully consumed: index: " SIZE_FORMAT ", size: " SIZE_FORMAT,
+           node->index(), buffer_size());
+    return node;
+  }
   handle_refined_buffer(node, fully_processed);
+  return NULL;
 }
 
 bool G1DirtyCardQueueSet::refine_completed_buffer_concurrently(uint worker_id,
@@ -236,7 +236,11 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // Mutator refinement, if performed, stops processing a buffer if
   // SuspendibleThreadSet::should_yield(), recording the incompletely
   // processed buffer for later processing of the remainder.
-  void handle_completed_buffer(BufferNode* node, G1ConcurrentRefineStats* stats);
+  //
+  // Returns the buffer refined by the mutator if it has been fully
+  // processed, for reuse by the caller instead of releasing it to the
+  // allocator and allocating a new one. Otherwise returns NULL.
+  BufferNode* handle_completed_buffer(BufferNode* node, G1ConcurrentRefineStats* stats);
 
 public:
   G1DirtyCardQueueSet(BufferNode::Allocator* allocator);
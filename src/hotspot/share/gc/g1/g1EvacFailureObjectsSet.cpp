@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/quickSort.hpp"
+
+G1EvacFailureObjectsSet::G1EvacFailureObjectsSet(uint region_idx, HeapWord* bottom) :
+  DEBUG_ONLY(_region_idx(region_idx) COMMA)
+  _bottom(bottom),
+  _current(NULL) { }
+
+G1EvacFailureObjectsSet::~G1EvacFailureObjectsSet() {
+  Segment* cur = Atomic::load(&_current);
+  while (cur != NULL) {
+    Segment* next = cur->_next;
+    delete cur;
+    cur = next;
+  }
+}
+
+G1EvacFailureObjectsSet::OffsetInRegion G1EvacFailureObjectsSet::to_offset(oop obj) const {
+  HeapWord* o = cast_from_oop<HeapWord*>(obj);
+  size_t offset = pointer_delta(o, _bottom);
+  assert(obj == from_offset(static_cast<OffsetInRegion>(offset)), "must be");
+  return static_cast<OffsetInRegion>(offset);
+}
+
+oop G1EvacFailureObjectsSet::from_offset(OffsetInRegion offset) const {
+  return cast_to_oop(_bottom + offset);
+}
+
+void G1EvacFailureObjectsSet::record(oop obj) {
+  assert(obj != NULL, "must be");
+  assert(_region_idx == G1CollectedHeap::heap()->heap_region_containing(obj)->hrm_index(), "must be");
+  OffsetInRegion offset = to_offset(obj);
+
+  Segment* cur = Atomic::load_acquire(&_current);
+  while (true) {
+    if (cur != NULL) {
+      uint idx = Atomic::fetch_and_add(&cur->_top, 1u);
+      if (idx < Segment::Length) {
+        cur->_data[idx] = offset;
+        return;
+      }
+    }
+    // No segment yet, or the current one is full; try to install a new one.
+    Segment* next = new Segment(cur);
+    Segment* witness = Atomic::cmpxchg(&_current, cur, next);
+    if (witness != cur) {
+      // Somebody else installed a new segment.
+      delete next;
+      cur = witness;
+    } else {
+      cur = next;
+    }
+  }
+}
+
+void G1EvacFailureObjectsSet::process_and_drop(ObjectClosure* blk) {
+  assert_at_safepoint();
+
+  size_t num = 0;
+  for (Segment* cur = _current; cur != NULL; cur = cur->_next) {
+    num += cur->length();
+  }
+
+  OffsetInRegion* offsets = NEW_C_HEAP_ARRAY(OffsetInRegion, num, mtGC);
+  size_t i = 0;
+  Segment* cur = _current;
+  while (cur != NULL) {
+    uint length = cur->length();
+    memcpy(&offsets[i], cur->_data, length * sizeof(OffsetInRegion));
+    i += length;
+
+    Segment* next = cur->_next;
+    delete cur;
+    cur = next;
+  }
+  _current = NULL;
+  assert(i == num, "must be");
+
+  QuickSort::sort(offsets, num, compare, true);
+
+  for (i = 0; i < num; i++) {
+    assert(i == 0 || offsets[i] > offsets[i - 1], "must be");
+    blk->do_object(from_offset(offsets[i]));
+  }
+
+  FREE_C_HEAP_ARRAY(OffsetInRegion, offsets);
+}
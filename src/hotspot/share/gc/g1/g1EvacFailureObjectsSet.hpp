@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+#define SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ObjectClosure;
+
+// This class collects the addresses of objects that failed evacuation in a
+// specific heap region. Elements are recorded lock-free by the evacuating
+// threads and are later iterated in address order, so that evacuation failure
+// handling only needs to touch the failed objects instead of walking all
+// objects in the region.
+class G1EvacFailureObjectsSet {
+  // Storage type of an object that failed evacuation within a region. Given
+  // the maximum heap region size it is sufficient to use the word offset from
+  // the bottom of the region instead of a full pointer.
+  typedef uint OffsetInRegion;
+
+  class Segment final : public CHeapObj<mtGC> {
+  public:
+    static const uint Length = 256;
+
+    Segment* const _next;
+    volatile uint _top;
+    OffsetInRegion _data[Length];
+
+    Segment(Segment* next) : _next(next), _top(0) { }
+
+    uint length() const { return MIN2(_top, Length); }
+  };
+
+  DEBUG_ONLY(uint _region_idx;)
+  HeapWord* _bottom;
+
+  // Most recently allocated segment; older segments are linked through _next.
+  Segment* volatile _current;
+
+  OffsetInRegion to_offset(oop obj) const;
+  oop from_offset(OffsetInRegion offset) const;
+
+  static int compare(OffsetInRegion a, OffsetInRegion b) {
+    return a < b ? -1 : (a == b ? 0 : 1);
+  }
+
+  NONCOPYABLE(G1EvacFailureObjectsSet);
+
+public:
+  G1EvacFailureObjectsSet(uint region_idx, HeapWord* bottom);
+  ~G1EvacFailureObjectsSet();
+
+  bool is_empty() const { return Atomic::load(&_current) == NULL; }
+
+  // Record an object that failed evacuation. May be called concurrently by
+  // multiple threads, but never for the same object twice.
+  void record(oop obj);
+
+  // Apply the given ObjectClosure to all recorded objects in increasing
+  // address order and drop the recorded objects afterwards.
+  void process_and_drop(ObjectClosure* blk);
+};
+
+#endif //SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
@@ -117,6 +117,7 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap,
     _array_queue_set(_num_workers),
     _preserved_marks_set(true),
     _serial_compaction_point(),
+    _serial_compaction_first_dest(NULL),
     _is_alive(this, heap->concurrent_mark()->next_mark_bitmap()),
     _is_alive_mutator(heap->ref_processor_stw(), &_is_alive),
     _always_subject_to_discovery(),
@@ -127,6 +128,7 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap,
   _preserved_marks_set.init(_num_workers);
   _markers = NEW_C_HEAP_ARRAY(G1FullGCMarker*, _num_workers, mtGC);
   _compaction_points = NEW_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _num_workers, mtGC);
+  _serial_compaction_first_dest = NEW_C_HEAP_ARRAY(uint, _num_workers, mtGC);
 
   _live_stats = NEW_C_HEAP_ARRAY(G1RegionMarkStats, _heap->max_regions(), mtGC);
   for (uint j = 0; j < heap->max_regions(); j++) {
@@ -149,6 +151,7 @@ G1FullCollector::~G1FullCollector() {
   }
   FREE_C_HEAP_ARRAY(G1FullGCMarker*, _markers);
   FREE_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _compaction_points);
+  FREE_C_HEAP_ARRAY(uint, _serial_compaction_first_dest);
   FREE_C_HEAP_ARRAY(G1RegionMarkStats, _live_stats);
 }
 
@@ -305,9 +308,12 @@ void G1FullCollector::phase4_do_compaction() {
   G1FullGCCompactTask task(this);
   run_task(&task);
 
-  // Serial compact to avoid OOM when very few free regions.
+  // Compact the last regions of all compaction queues to avoid OOM when
+  // there are very few free regions.
   if (serial_compaction_point()->has_regions()) {
-    task.serial_compaction();
+    GCTraceTime(Debug, gc, phases) tm("Phase 4: Serial Compaction", scope()->timer());
+    G1FullGCSerialCompactTask serial_task(this);
+    _heap->workers()->run_task(&serial_task, serial_task.num_workers());
   }
 }
 
@@ -66,6 +66,9 @@ class G1FullCollector : StackObj {
   ObjArrayTaskQueueSet      _array_queue_set;
   PreservedMarksSet         _preserved_marks_set;
   G1FullGCCompactionPoint   _serial_compaction_point;
+  // For every region in the serial compaction point, the index of the first
+  // region in that compaction point it is compacted into.
+  uint*                     _serial_compaction_first_dest;
   G1IsAliveClosure          _is_alive;
   ReferenceProcessorIsAliveMutator _is_alive_mutator;
   G1RegionMarkStats*        _live_stats;
@@ -96,6 +99,15 @@ public:
   ObjArrayTaskQueueSet*    array_queue_set() { return &_array_queue_set; }
   PreservedMarksSet*       preserved_mark_set() { return &_preserved_marks_set; }
   G1FullGCCompactionPoint* serial_compaction_point() { return &_serial_compaction_point; }
+  uint serial_compaction_first_dest(uint index) const {
+    assert(index < _num_workers, "index out of bounds: %u", index);
+    return _serial_compaction_first_dest[index];
+  }
+  void set_serial_compaction_first_dest(uint index, uint first_dest) {
+    assert(index < _num_workers, "index out of bounds: %u", index);
+    assert(first_dest <= index, "regions are only compacted downwards: %u > %u", first_dest, index);
+    _serial_compaction_first_dest[index] = first_dest;
+  }
   G1CMBitMap*              mark_bitmap();
   ReferenceProcessor*      reference_processor();
   size_t live_words(uint region_index) {
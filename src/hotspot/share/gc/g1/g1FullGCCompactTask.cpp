@@ -33,6 +33,8 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/spinYield.hpp"
 #include "utilities/ticks.hpp"
 
 // Do work for all skip-compacting regions.
@@ -76,15 +78,15 @@ size_t G1FullGCCompactTask::G1CompactRegionClosure::apply(oop obj) {
   return size;
 }
 
-void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
+void G1FullGCCompactTask::compact_region(G1FullCollector* collector, HeapRegion* hr) {
   assert(!hr->is_pinned(), "Should be no pinned region in compaction queue");
   assert(!hr->is_humongous(), "Should be no humongous regions in compaction queue");
-  G1CompactRegionClosure compact(collector()->mark_bitmap());
-  hr->apply_to_marked_objects(collector()->mark_bitmap(), &compact);
+  G1CompactRegionClosure compact(collector->mark_bitmap());
+  hr->apply_to_marked_objects(collector->mark_bitmap(), &compact);
   // Clear the liveness information for this region if necessary i.e. if we actually look at it
   // for bitmap verification. Otherwise it is sufficient that we move the TAMS to bottom().
   if (G1VerifyBitmaps) {
-    collector()->mark_bitmap()->clear_region(hr);
+    collector->mark_bitmap()->clear_region(hr);
   }
   hr->reset_compacted_after_full_gc();
 }
@@ -95,7 +97,7 @@ void G1FullGCCompactTask::work(uint worker_id) {
   for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
        it != compaction_queue->end();
        ++it) {
-    compact_region(*it);
+    compact_region(collector(), *it);
   }
 
   G1ResetSkipCompactingClosure hc(collector());
@@ -103,12 +105,46 @@ void G1FullGCCompactTask::work(uint worker_id) {
   log_task("Compaction task", worker_id, start);
 }
 
-void G1FullGCCompactTask::serial_compaction() {
-  GCTraceTime(Debug, gc, phases) tm("Phase 4: Serial Compaction", collector()->scope()->timer());
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->serial_compaction_point()->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+G1FullGCSerialCompactTask::G1FullGCSerialCompactTask(G1FullCollector* collector) :
+    G1FullGCTask("G1 Serial Compact Task", collector),
+    _regions(collector->serial_compaction_point()->regions()),
+    _claimed(0),
+    _compacted(NULL) {
+  uint num_regions = (uint)_regions->length();
+  _compacted = NEW_C_HEAP_ARRAY(bool, num_regions, mtGC);
+  for (uint i = 0; i < num_regions; i++) {
+    _compacted[i] = false;
+  }
+}
+
+G1FullGCSerialCompactTask::~G1FullGCSerialCompactTask() {
+  FREE_C_HEAP_ARRAY(bool, _compacted);
+}
+
+uint G1FullGCSerialCompactTask::num_workers() {
+  return MIN2(collector()->workers(), (uint)_regions->length());
+}
+
+void G1FullGCSerialCompactTask::wait_for_destinations(uint index) {
+  for (uint i = collector()->serial_compaction_first_dest(index); i < index; i++) {
+    SpinYield spin_yield;
+    while (!Atomic::load_acquire(&_compacted[i])) {
+      spin_yield.wait();
+    }
+  }
+}
+
+void G1FullGCSerialCompactTask::work(uint worker_id) {
+  Ticks start = Ticks::now();
+  uint const num_regions = (uint)_regions->length();
+  // Regions only depend on regions earlier in the queue. Since these are
+  // claimed first, waiting for them can not deadlock.
+  for (uint index = Atomic::fetch_and_add(&_claimed, 1u);
+       index < num_regions;
+       index = Atomic::fetch_and_add(&_claimed, 1u)) {
+    wait_for_destinations(index);
+    G1FullGCCompactTask::compact_region(collector(), _regions->at(index));
+    Atomic::release_store(&_compacted[index], true);
   }
+  log_task("Serial compaction task", worker_id, start);
 }
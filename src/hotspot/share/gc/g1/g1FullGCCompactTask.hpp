@@ -39,15 +39,13 @@ class G1FullGCCompactTask : public G1FullGCTask {
 protected:
   HeapRegionClaimer _claimer;
 
-private:
-  void compact_region(HeapRegion* hr);
-
 public:
   G1FullGCCompactTask(G1FullCollector* collector) :
     G1FullGCTask("G1 Compact Task", collector),
     _claimer(collector->workers()) { }
   void work(uint worker_id);
-  void serial_compaction();
+
+  static void compact_region(G1FullCollector* collector, HeapRegion* hr);
 
   class G1CompactRegionClosure : public StackObj {
     G1CMBitMap* _bitmap;
@@ -58,4 +56,25 @@ public:
   };
 };
 
+// Compacts the regions of the serial compaction point. Objects of these
+// regions slide down into earlier regions of the same compaction point, so a
+// region can only be compacted after all regions it is compacted into
+// (other than itself) have been compacted. Workers claim regions in queue
+// order and wait for these dependencies, so regions with disjoint
+// destinations are compacted in parallel.
+class G1FullGCSerialCompactTask : public G1FullGCTask {
+  GrowableArray<HeapRegion*>* _regions;
+  volatile uint _claimed;
+  volatile bool* _compacted;
+
+  void wait_for_destinations(uint index);
+
+public:
+  G1FullGCSerialCompactTask(G1FullCollector* collector);
+  ~G1FullGCSerialCompactTask();
+
+  uint num_workers();
+  void work(uint worker_id);
+};
+
 #endif // SHARE_GC_G1_G1FULLGCCOMPACTTASK_HPP
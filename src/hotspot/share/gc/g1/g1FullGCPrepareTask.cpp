@@ -227,16 +227,20 @@ void G1FullGCPrepareTask::prepare_serial_compaction() {
   }
 
   // Update the forwarding information for the regions in the serial
-  // compaction point.
+  // compaction point. Also record the first region each region is compacted
+  // into, which allows compacting regions with disjoint destinations in parallel.
   G1FullGCCompactionPoint* cp = collector()->serial_compaction_point();
-  for (GrowableArrayIterator<HeapRegion*> it = cp->regions()->begin(); it != cp->regions()->end(); ++it) {
-    HeapRegion* current = *it;
+  GrowableArray<HeapRegion*>* regions = cp->regions();
+  for (int i = 0; i < regions->length(); i++) {
+    HeapRegion* current = regions->at(i);
     if (!cp->is_initialized()) {
       // Initialize the compaction point. Nothing more is needed for the first heap region
       // since it is already prepared for compaction.
       cp->initialize(current, false);
+      collector()->set_serial_compaction_first_dest((uint)i, (uint)i);
     } else {
       assert(!current->is_humongous(), "Should be no humongous regions in compaction queue");
+      collector()->set_serial_compaction_first_dest((uint)i, (uint)regions->find(cp->current_region()));
       G1RePrepareClosure re_prepare(cp, current);
       current->set_compaction_top(current->bottom());
       current->apply_to_marked_objects(collector()->mark_bitmap(), &re_prepare);
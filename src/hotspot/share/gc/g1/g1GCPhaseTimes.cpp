@@ -112,10 +112,12 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _gc_par_phases[ScanHR]->create_thread_work_items("Scanned Cards:", ScanHRScannedCards);
   _gc_par_phases[ScanHR]->create_thread_work_items("Scanned Blocks:", ScanHRScannedBlocks);
   _gc_par_phases[ScanHR]->create_thread_work_items("Claimed Chunks:", ScanHRClaimedChunks);
+  _gc_par_phases[ScanHR]->create_thread_work_items("BOT Lookups:", ScanHRBOTLookups);
 
   _gc_par_phases[OptScanHR]->create_thread_work_items("Scanned Cards:", ScanHRScannedCards);
   _gc_par_phases[OptScanHR]->create_thread_work_items("Scanned Blocks:", ScanHRScannedBlocks);
   _gc_par_phases[OptScanHR]->create_thread_work_items("Claimed Chunks:", ScanHRClaimedChunks);
+  _gc_par_phases[OptScanHR]->create_thread_work_items("BOT Lookups:", ScanHRBOTLookups);
   _gc_par_phases[OptScanHR]->create_thread_work_items("Scanned Refs:", ScanHRScannedOptRefs);
   _gc_par_phases[OptScanHR]->create_thread_work_items("Used Memory:", ScanHRUsedMemory);
 
@@ -311,6 +313,20 @@ size_t G1GCPhaseTimes::sum_thread_work_items(GCParPhases phase, uint index) {
   return _gc_par_phases[phase]->thread_work_items(index)->sum();
 }
 
+double G1GCPhaseTimes::evacuation_parallel_efficiency(uint num_workers) {
+  double work_time = 0.0;
+  double max_worker_time = 0.0;
+  for (uint i = 0; i < num_workers; i++) {
+    double const total_time = worker_time(GCWorkerTotal, i);
+    work_time += total_time - worker_time(Termination, i) - worker_time(OptTermination, i);
+    max_worker_time = MAX2(max_worker_time, total_time);
+  }
+  if (max_worker_time == 0.0) {
+    return 1.0;
+  }
+  return work_time / (max_worker_time * num_workers);
+}
+
 template <class T>
 void G1GCPhaseTimes::details(T* phase, const char* indent_str) const {
   LogTarget(Trace, gc, phases, task) lt;
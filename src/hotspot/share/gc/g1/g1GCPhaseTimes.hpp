@@ -100,6 +100,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     ScanHRScannedCards,
     ScanHRScannedBlocks,
     ScanHRClaimedChunks,
+    ScanHRBOTLookups,
     ScanHRScannedOptRefs,
     ScanHRUsedMemory
   };
@@ -248,6 +249,11 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   size_t sum_thread_work_items(GCParPhases phase, uint index = 0);
 
+  // Return the parallel efficiency of the evacuation by num_workers workers,
+  // i.e. the share of the time until the last worker finished the workers
+  // spent outside of termination.
+  double evacuation_parallel_efficiency(uint num_workers);
+
   void record_prepare_tlab_time_ms(double ms) {
     _cur_prepare_tlab_time_ms = ms;
   }
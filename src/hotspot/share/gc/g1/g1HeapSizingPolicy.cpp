@@ -176,6 +176,15 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
     // and at most the remaining uncommitted byte size.
     expand_bytes = clamp(expand_bytes, min_expand_bytes, uncommitted_bytes);
 
+    // Do not grow beyond SoftMaxHeapSize to reduce GC overhead. The heap
+    // still grows beyond it when needed to satisfy allocations.
+    size_t const soft_max_capacity = SoftMaxHeapSize;
+    if (committed_bytes >= soft_max_capacity) {
+      expand_bytes = 0;
+    } else {
+      expand_bytes = MIN2(expand_bytes, soft_max_capacity - committed_bytes);
+    }
+
     clear_ratio_check_data();
   } else {
     // An expansion was not triggered. If we've started counting, increment
@@ -236,6 +245,10 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // with respect to the heap max size as it's an upper bound (i.e.,
   // we'll try to make the capacity smaller than it, not greater).
   maximum_desired_capacity =  MAX2(maximum_desired_capacity, MinHeapSize);
+  // Shrink towards SoftMaxHeapSize, but keep at least the minimum desired
+  // capacity so that honoring it does not cause back-to-back GCs.
+  maximum_desired_capacity = MIN2(maximum_desired_capacity,
+                                  MAX3(SoftMaxHeapSize, minimum_desired_capacity, MinHeapSize));
 
   // Don't expand unless it's significant; prefer expansion to shrinking.
   if (capacity_after_gc < minimum_desired_capacity) {
@@ -25,9 +25,11 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1IHOPControl.hpp"
+#include "gc/g1/g1MonitoringSupport.hpp"
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/g1/g1Trace.hpp"
 #include "logging/log.hpp"
+#include "utilities/quickSort.hpp"
 
 G1IHOPControl::G1IHOPControl(double initial_ihop_percent,
                              G1OldGenAllocationTracker const* old_gen_alloc_tracker) :
@@ -76,6 +78,11 @@ void G1IHOPControl::send_trace_event(G1NewTracer* tracer) {
                                        last_marking_length_s());
 }
 
+void G1IHOPControl::update_perf_counters(G1MonitoringSupport* g1mm) {
+  assert(_target_occupancy > 0, "Target occupancy still not updated yet.");
+  g1mm->update_ihop_counters(get_conc_mark_start_threshold(), _target_occupancy);
+}
+
 G1StaticIHOPControl::G1StaticIHOPControl(double ihop_percent,
                                          G1OldGenAllocationTracker const* old_gen_alloc_tracker) :
   G1IHOPControl(ihop_percent, old_gen_alloc_tracker),
@@ -86,15 +93,22 @@ G1AdaptiveIHOPControl::G1AdaptiveIHOPControl(double ihop_percent,
                                              G1OldGenAllocationTracker const* old_gen_alloc_tracker,
                                              G1Predictions const* predictor,
                                              size_t heap_reserve_percent,
-                                             size_t heap_waste_percent) :
+                                             size_t heap_waste_percent,
+                                             uint allocation_rate_percentile) :
   G1IHOPControl(ihop_percent, old_gen_alloc_tracker),
   _heap_reserve_percent(heap_reserve_percent),
   _heap_waste_percent(heap_waste_percent),
+  _allocation_rate_percentile(allocation_rate_percentile),
   _predictor(predictor),
   _marking_times_s(10, 0.05),
   _allocation_rate_s(10, 0.05),
+  _num_recent_allocation_rates(0),
+  _next_recent_allocation_rate(0),
+  _percentile_allocation_rate(0.0),
   _last_unrestrained_young_size(0)
 {
+  assert(_allocation_rate_percentile <= 100,
+         "Allocation rate percentile must be between 0 and 100 but is %u", _allocation_rate_percentile);
 }
 
 size_t G1AdaptiveIHOPControl::actual_target_threshold() const {
@@ -124,10 +138,43 @@ bool G1AdaptiveIHOPControl::have_enough_data_for_prediction() const {
          ((size_t)_allocation_rate_s.num() >= G1AdaptiveIHOPNumInitialSamples);
 }
 
+void G1AdaptiveIHOPControl::add_recent_allocation_rate(double rate) {
+  _recent_allocation_rates[_next_recent_allocation_rate] = rate;
+  _next_recent_allocation_rate = (_next_recent_allocation_rate + 1) % AllocationRateWindowLength;
+  _num_recent_allocation_rates = MIN2(_num_recent_allocation_rates + 1, AllocationRateWindowLength);
+}
+
+static int compare_allocation_rates(double a, double b) {
+  if (a < b) {
+    return -1;
+  } else if (a > b) {
+    return 1;
+  }
+  return 0;
+}
+
+double G1AdaptiveIHOPControl::calculate_percentile_allocation_rate() const {
+  assert(_num_recent_allocation_rates > 0, "must have at least one sample");
+
+  double sorted[AllocationRateWindowLength];
+  for (uint i = 0; i < _num_recent_allocation_rates; i++) {
+    sorted[i] = _recent_allocation_rates[i];
+  }
+  QuickSort::sort(sorted, _num_recent_allocation_rates, compare_allocation_rates, false);
+
+  // Nearest-rank percentile.
+  uint rank = (_allocation_rate_percentile * _num_recent_allocation_rates + 99) / 100;
+  return sorted[MAX2(rank, 1u) - 1];
+}
+
+double G1AdaptiveIHOPControl::predict_allocation_rate() const {
+  return MAX2(predict(&_allocation_rate_s), _percentile_allocation_rate);
+}
+
 size_t G1AdaptiveIHOPControl::get_conc_mark_start_threshold() {
   if (have_enough_data_for_prediction()) {
     double pred_marking_time = predict(&_marking_times_s);
-    double pred_promotion_rate = predict(&_allocation_rate_s);
+    double pred_promotion_rate = predict_allocation_rate();
     size_t pred_promotion_size = (size_t)(pred_marking_time * pred_promotion_rate);
 
     size_t predicted_needed_bytes_during_marking =
@@ -156,7 +203,13 @@ double G1AdaptiveIHOPControl::last_mutator_period_old_allocation_rate() const {
 void G1AdaptiveIHOPControl::update_allocation_info(double allocation_time_s,
                                                    size_t additional_buffer_size) {
   G1IHOPControl::update_allocation_info(allocation_time_s, additional_buffer_size);
-  _allocation_rate_s.add(last_mutator_period_old_allocation_rate());
+
+  double allocation_rate = last_mutator_period_old_allocation_rate();
+  _allocation_rate_s.add(allocation_rate);
+  if (_allocation_rate_percentile > 0) {
+    add_recent_allocation_rate(allocation_rate);
+    _percentile_allocation_rate = calculate_percentile_allocation_rate();
+  }
 
   _last_unrestrained_young_size = additional_buffer_size;
 }
@@ -170,14 +223,17 @@ void G1AdaptiveIHOPControl::print() {
   G1IHOPControl::print();
   size_t actual_target = actual_target_threshold();
   log_debug(gc, ihop)("Adaptive IHOP information (value update), threshold: " SIZE_FORMAT "B (%1.2f), internal target occupancy: " SIZE_FORMAT "B, "
-                      "occupancy: " SIZE_FORMAT "B, additional buffer size: " SIZE_FORMAT "B, predicted old gen allocation rate: %1.2fB/s, "
-                      "predicted marking phase length: %1.2fms, prediction active: %s",
+                      "occupancy: " SIZE_FORMAT "B, additional buffer size: " SIZE_FORMAT "B, predicted old gen allocation rate: %1.2fB/s "
+                      "(average %1.2fB/s, p%u %1.2fB/s), predicted marking phase length: %1.2fms, prediction active: %s",
                       get_conc_mark_start_threshold(),
                       percent_of(get_conc_mark_start_threshold(), actual_target),
                       actual_target,
                       G1CollectedHeap::heap()->used(),
                       _last_unrestrained_young_size,
+                      predict_allocation_rate(),
                       predict(&_allocation_rate_s),
+                      _allocation_rate_percentile,
+                      _percentile_allocation_rate,
                       predict(&_marking_times_s) * 1000.0,
                       have_enough_data_for_prediction() ? "true" : "false");
 }
@@ -188,7 +244,15 @@ void G1AdaptiveIHOPControl::send_trace_event(G1NewTracer* tracer) {
                                           actual_target_threshold(),
                                           G1CollectedHeap::heap()->used(),
                                           _last_unrestrained_young_size,
-                                          predict(&_allocation_rate_s),
+                                          predict_allocation_rate(),
                                           predict(&_marking_times_s),
                                           have_enough_data_for_prediction());
 }
+
+void G1AdaptiveIHOPControl::update_perf_counters(G1MonitoringSupport* g1mm) {
+  G1IHOPControl::update_perf_counters(g1mm);
+  g1mm->update_adaptive_ihop_counters(predict(&_allocation_rate_s),
+                                      _percentile_allocation_rate,
+                                      predict(&_marking_times_s),
+                                      _last_unrestrained_young_size);
+}
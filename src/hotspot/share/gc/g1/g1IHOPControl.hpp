@@ -29,6 +29,7 @@
 #include "memory/allocation.hpp"
 #include "utilities/numberSeq.hpp"
 
+class G1MonitoringSupport;
 class G1Predictions;
 class G1NewTracer;
 
@@ -78,6 +79,7 @@ class G1IHOPControl : public CHeapObj<mtGC> {
 
   virtual void print();
   virtual void send_trace_event(G1NewTracer* tracer);
+  virtual void update_perf_counters(G1MonitoringSupport* g1mm);
 };
 
 // The returned concurrent mark starting occupancy threshold is a fixed value
@@ -106,15 +108,33 @@ class G1StaticIHOPControl : public G1IHOPControl {
 // makes sure that during marking the given target occupancy is never exceeded,
 // based on predictions of current allocation rate and time periods between
 // concurrent start and the first mixed gc.
+//
+// If a non-zero allocation rate percentile is given, the predicted old gen
+// allocation rate is additionally bounded below by that percentile of a window
+// of the most recent allocation rate samples. This makes the threshold
+// account for recurring allocation bursts that the decaying averages smooth out.
 class G1AdaptiveIHOPControl : public G1IHOPControl {
+  // Number of most recent old gen allocation rate samples kept for the
+  // percentile based prediction.
+  static const uint AllocationRateWindowLength = 32;
+
   size_t _heap_reserve_percent; // Percentage of maximum heap capacity we should avoid to touch
   size_t _heap_waste_percent;   // Percentage of free heap that should be considered as waste.
+  uint _allocation_rate_percentile; // Percentile of recent allocation rates to plan for, 0 if disabled.
 
   const G1Predictions * _predictor;
 
   TruncatedSeq _marking_times_s;
   TruncatedSeq _allocation_rate_s;
 
+  // Ring buffer of the most recent old gen allocation rate samples.
+  double _recent_allocation_rates[AllocationRateWindowLength];
+  uint _num_recent_allocation_rates;
+  uint _next_recent_allocation_rate;
+  // The configured percentile of _recent_allocation_rates, recalculated on
+  // every sample.
+  double _percentile_allocation_rate;
+
   // The most recent unrestrained size of the young gen. This is used as an additional
   // factor in the calculation of the threshold, as the threshold is based on
   // non-young gen occupancy at the end of GC. For the IHOP threshold, we need to
@@ -137,6 +157,11 @@ class G1AdaptiveIHOPControl : public G1IHOPControl {
   // This method calculates the old gen allocation rate based on the net survived
   // bytes that are allocated in the old generation in the last mutator period.
   double last_mutator_period_old_allocation_rate() const;
+
+  void add_recent_allocation_rate(double rate);
+  double calculate_percentile_allocation_rate() const;
+  // The old gen allocation rate used for the threshold calculation.
+  double predict_allocation_rate() const;
  protected:
   virtual double last_marking_length_s() const { return _marking_times_s.last(); }
  public:
@@ -144,7 +169,8 @@ class G1AdaptiveIHOPControl : public G1IHOPControl {
                         G1OldGenAllocationTracker const* old_gen_alloc_tracker,
                         G1Predictions const* predictor,
                         size_t heap_reserve_percent, // The percentage of total heap capacity that should not be tapped into.
-                        size_t heap_waste_percent);  // The percentage of the free space in the heap that we think is not usable for allocation.
+                        size_t heap_waste_percent,   // The percentage of the free space in the heap that we think is not usable for allocation.
+                        uint allocation_rate_percentile = 0); // The percentile of recent allocation rates to plan for, 0 to disable.
 
   virtual size_t get_conc_mark_start_threshold();
 
@@ -153,6 +179,7 @@ class G1AdaptiveIHOPControl : public G1IHOPControl {
 
   virtual void print();
   virtual void send_trace_event(G1NewTracer* tracer);
+  virtual void update_perf_counters(G1MonitoringSupport* g1mm);
 };
 
 #endif // SHARE_GC_G1_G1IHOPCONTROL_HPP
@@ -29,6 +29,8 @@
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/shared/hSpaceCounters.hpp"
 #include "memory/metaspaceCounters.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/os.hpp"
 #include "services/memoryPool.hpp"
 
 class G1GenerationCounters : public GenerationCounters {
@@ -100,6 +102,12 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
   _eden_space_counters(NULL),
   _from_space_counters(NULL),
   _to_space_counters(NULL),
+  _ihop_threshold(NULL),
+  _ihop_target_occupancy(NULL),
+  _ihop_predicted_allocation_rate(NULL),
+  _ihop_percentile_allocation_rate(NULL),
+  _ihop_predicted_marking_length(NULL),
+  _ihop_unrestrained_young_size(NULL),
 
   _overall_committed(0),
   _overall_used(0),
@@ -180,6 +188,34 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
     "s1", 2 /* ordinal */,
     pad_capacity(g1h->max_capacity()) /* max_capacity */,
     pad_capacity(_survivor_space_committed) /* init_capacity */);
+
+  // IHOP counters, name "ihop.*". Only the threshold and target occupancy
+  // are updated for a static IHOP.
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+
+    const char* ns = "ihop";
+    _ihop_threshold =
+      PerfDataManager::create_variable(SUN_GC, PerfDataManager::counter_name(ns, "threshold"),
+                                       PerfData::U_Bytes, CHECK);
+    _ihop_target_occupancy =
+      PerfDataManager::create_variable(SUN_GC, PerfDataManager::counter_name(ns, "targetOccupancy"),
+                                       PerfData::U_Bytes, CHECK);
+    // Allocation rates are in bytes per second.
+    _ihop_predicted_allocation_rate =
+      PerfDataManager::create_variable(SUN_GC, PerfDataManager::counter_name(ns, "predictedAllocationRate"),
+                                       PerfData::U_None, CHECK);
+    _ihop_percentile_allocation_rate =
+      PerfDataManager::create_variable(SUN_GC, PerfDataManager::counter_name(ns, "percentileAllocationRate"),
+                                       PerfData::U_None, CHECK);
+    _ihop_predicted_marking_length =
+      PerfDataManager::create_variable(SUN_GC, PerfDataManager::counter_name(ns, "predictedMarkingTime"),
+                                       PerfData::U_Ticks, CHECK);
+    _ihop_unrestrained_young_size =
+      PerfDataManager::create_variable(SUN_GC, PerfDataManager::counter_name(ns, "unrestrainedYoungSize"),
+                                       PerfData::U_Bytes, CHECK);
+  }
 }
 
 G1MonitoringSupport::~G1MonitoringSupport() {
@@ -316,6 +352,25 @@ void G1MonitoringSupport::update_eden_size() {
   }
 }
 
+void G1MonitoringSupport::update_ihop_counters(size_t threshold, size_t target_occupancy) {
+  if (UsePerfData) {
+    _ihop_threshold->set_value(threshold);
+    _ihop_target_occupancy->set_value(target_occupancy);
+  }
+}
+
+void G1MonitoringSupport::update_adaptive_ihop_counters(double predicted_allocation_rate,
+                                                        double percentile_allocation_rate,
+                                                        double predicted_marking_length_s,
+                                                        size_t unrestrained_young_size) {
+  if (UsePerfData) {
+    _ihop_predicted_allocation_rate->set_value((jlong)predicted_allocation_rate);
+    _ihop_percentile_allocation_rate->set_value((jlong)percentile_allocation_rate);
+    _ihop_predicted_marking_length->set_value((jlong)(predicted_marking_length_s * os::elapsed_frequency()));
+    _ihop_unrestrained_young_size->set_value(unrestrained_young_size);
+  }
+}
+
 MemoryUsage G1MonitoringSupport::eden_space_memory_usage(size_t initial_size, size_t max_size) {
   MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
 
@@ -155,6 +155,13 @@ class G1MonitoringSupport : public CHeapObj<mtGC> {
   //   the survivor collection (only one, _to_counters, is actively used)
   HSpaceCounters*      _from_space_counters;
   HSpaceCounters*      _to_space_counters;
+  // IHOP threshold and the inputs of its prediction.
+  PerfVariable*        _ihop_threshold;
+  PerfVariable*        _ihop_target_occupancy;
+  PerfVariable*        _ihop_predicted_allocation_rate;
+  PerfVariable*        _ihop_percentile_allocation_rate;
+  PerfVariable*        _ihop_predicted_marking_length;
+  PerfVariable*        _ihop_unrestrained_young_size;
 
   // When it's appropriate to recalculate the various sizes (at the
   // end of a GC, when a new eden region is allocated, etc.) we store
@@ -210,6 +217,14 @@ public:
 
   void update_eden_size();
 
+  // Update the jstat counters describing the current IHOP threshold and the
+  // inputs used to calculate it.
+  void update_ihop_counters(size_t threshold, size_t target_occupancy);
+  void update_adaptive_ihop_counters(double predicted_allocation_rate,
+                                     double percentile_allocation_rate,
+                                     double predicted_marking_length_s,
+                                     size_t unrestrained_young_size);
+
   CollectorCounters* conc_collection_counters() {
     return _conc_collection_counters;
   }
@@ -155,6 +155,8 @@ static const char* phase_to_explanatory_string(G1NUMAStats::NodeDataItems phase)
   switch(phase) {
     case G1NUMAStats::NewRegionAlloc:
       return "Placement match ratio";
+    case G1NUMAStats::NewGCRegionAlloc:
+      return "GC alloc region placement match ratio";
     case G1NUMAStats::LocalObjProcessAtCopyToSurv:
       return "Worker task locality match ratio";
     default:
@@ -226,5 +228,7 @@ void G1NUMAStats::print_statistics() {
   print_info(NewRegionAlloc);
   print_mutator_alloc_stat_debug();
 
+  print_info(NewGCRegionAlloc);
+
   print_info(LocalObjProcessAtCopyToSurv);
 }
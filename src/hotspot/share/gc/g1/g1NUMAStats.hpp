@@ -85,6 +85,8 @@ public:
   enum NodeDataItems {
     // Statistics of a new region allocation.
     NewRegionAlloc,
+    // Statistics of a new survivor or old region allocation during GC.
+    NewGCRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
     NodeDataItemsSentinel
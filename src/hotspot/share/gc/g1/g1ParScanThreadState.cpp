@@ -622,6 +622,10 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
       _g1h->hr_printer()->evac_failure(r);
     }
 
+    // Record the object so that self-forwarding removal does not need to
+    // walk all objects in the region.
+    r->record_evac_failure_obj(old);
+
     _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
 
     G1ScanInYoungSetter x(&_scanner, r->is_young());
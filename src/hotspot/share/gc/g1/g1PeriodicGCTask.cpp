@@ -32,6 +32,27 @@
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+// Minimum time between two periodic GCs triggered by memory pressure. This
+// is the averaging window of the pressure value, so a GC's effect shows in
+// the value before the next one can be triggered.
+static const uintx MemoryPressureGCMinInterval = 10 * MILLIUNITS;
+
+static bool is_memory_pressure_high() {
+  if (G1PeriodicGCMemoryPressureThreshold == 0.0) {
+    return false;
+  }
+  double pressure;
+  if (os::memory_pressure(&pressure) == -1) {
+    return false;
+  }
+  if (pressure <= G1PeriodicGCMemoryPressureThreshold) {
+    return false;
+  }
+  log_debug(gc, periodic)("Memory pressure %1.2f is higher than threshold %1.2f.",
+                          pressure, G1PeriodicGCMemoryPressureThreshold);
+  return true;
+}
+
 bool G1PeriodicGCTask::should_start_periodic_gc() {
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
   // If we are currently in a concurrent mark we are going to uncommit memory soon.
@@ -40,9 +61,14 @@ bool G1PeriodicGCTask::should_start_periodic_gc() {
     return false;
   }
 
-  // Check if enough time has passed since the last GC.
   uintx time_since_last_gc = (uintx)g1h->time_since_last_collection().milliseconds();
-  if ((time_since_last_gc < G1PeriodicGCInterval)) {
+  // High memory pressure asks for memory back, whatever the interval.
+  if (time_since_last_gc >= MemoryPressureGCMinInterval && is_memory_pressure_high()) {
+    return true;
+  }
+
+  // Check if enough time has passed since the last GC.
+  if (G1PeriodicGCInterval == 0 || (time_since_last_gc < G1PeriodicGCInterval)) {
     log_debug(gc, periodic)("Last GC occurred " UINTX_FORMAT "ms before which is below threshold " UINTX_FORMAT "ms. Skipping.",
                             time_since_last_gc, G1PeriodicGCInterval);
     return false;
@@ -61,7 +87,7 @@ bool G1PeriodicGCTask::should_start_periodic_gc() {
 
 void G1PeriodicGCTask::check_for_periodic_gc() {
   // If disabled, just return.
-  if (G1PeriodicGCInterval == 0) {
+  if (G1PeriodicGCInterval == 0 && G1PeriodicGCMemoryPressureThreshold == 0.0) {
     return;
   }
 
@@ -81,6 +107,10 @@ void G1PeriodicGCTask::execute() {
   // G1PeriodicGCInterval is a manageable flag and can be updated
   // during runtime. If no value is set, wait a second and run it
   // again to see if the value has been updated. Otherwise use the
-  // real value provided.
-  schedule(G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval);
+  // real value provided. Memory pressure is checked at least every second.
+  uintx interval = G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval;
+  if (G1PeriodicGCMemoryPressureThreshold > 0.0) {
+    interval = MIN2(interval, (uintx)1000);
+  }
+  schedule(interval);
 }
@@ -71,6 +71,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _rs_length(0),
   _rs_length_prediction(0),
   _pending_cards_at_gc_start(0),
+  _evacuation_worker_limit(UINT_MAX),
   _concurrent_start_to_mixed(),
   _collection_set(NULL),
   _g1h(NULL),
@@ -80,7 +81,8 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _mark_cleanup_start_sec(0),
   _tenuring_threshold(MaxTenuringThreshold),
   _max_survivor_regions(0),
-  _survivors_age_table(true)
+  _survivors_age_table(true),
+  _prev_survivors_age_table(false)
 {
 }
 
@@ -451,6 +453,10 @@ void G1Policy::record_full_collection_end() {
 
   _free_regions_at_end_of_collection = _g1h->num_free_regions();
   _survivor_surv_rate_group->reset();
+  // The Full GC moved all survivors into the old generation, so there is
+  // no previous survivor age distribution to compare the next one with.
+  _prev_survivors_age_table.clear();
+  _survivors_age_table.clear();
   update_young_list_max_and_target_length();
   update_rs_length_prediction();
 
@@ -531,6 +537,8 @@ void G1Policy::record_collection_pause_start(double start_time_sec) {
 
   // do that for any other surv rate groups
   _eden_surv_rate_group->stop_adding_regions();
+  _prev_survivors_age_table.clear();
+  _prev_survivors_age_table.merge(&_survivors_age_table);
   _survivors_age_table.clear();
 
   assert(_g1h->collection_set()->verify_young_ages(), "region age verification failed");
@@ -623,6 +631,28 @@ double G1Policy::logged_cards_processing_time() const {
 // Anything below that is considered to be zero
 #define MIN_TIMER_GRANULARITY 0.0000001
 
+uint G1Policy::calc_evacuation_workers(uint active_workers) const {
+  return MIN2(active_workers, _evacuation_worker_limit);
+}
+
+void G1Policy::update_evacuation_worker_limit() {
+  if (G1ParallelEfficiencyTarget == 0) {
+    return;
+  }
+  uint const num_workers = _g1h->workers()->active_workers();
+  double const efficiency = phase_times()->evacuation_parallel_efficiency(num_workers);
+  double const target = G1ParallelEfficiencyTarget / 100.0;
+  if (efficiency < target) {
+    // Use as many workers as would have been busy at the target efficiency.
+    _evacuation_worker_limit = MAX2(1u, (uint) ceil(efficiency * num_workers / target));
+  } else {
+    // Probe whether one more worker still scales well enough.
+    _evacuation_worker_limit = num_workers + 1;
+  }
+  log_debug(gc, task)("Evacuation parallel efficiency %.1f%% with %u workers, worker limit %u",
+                      efficiency * 100.0, num_workers, _evacuation_worker_limit);
+}
+
 void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent_operation_is_full_mark) {
   G1GCPhaseTimes* p = phase_times();
 
@@ -663,6 +693,8 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
 
   record_pause(this_pause, start_time_sec, end_time_sec);
 
+  update_evacuation_worker_limit();
+
   if (G1GCPauseTypeHelper::is_last_young_pause(this_pause)) {
     assert(!G1GCPauseTypeHelper::is_concurrent_start_pause(this_pause),
            "The young GC before mixed is not allowed to be concurrent start GC");
@@ -795,6 +827,7 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
                            G1GCPauseTypeHelper::is_young_only_pause(this_pause));
 
     _ihop_control->send_trace_event(_g1h->gc_tracer_stw());
+    _ihop_control->update_perf_counters(_g1h->g1mm());
   } else {
     // Any garbage collection triggered as periodic collection resets the time-to-mixed
     // measurement. Periodic collection typically means that the application is "inactive", i.e.
@@ -835,7 +868,8 @@ G1IHOPControl* G1Policy::create_ihop_control(const G1OldGenAllocationTracker* ol
                                      old_gen_alloc_tracker,
                                      predictor,
                                      G1ReservePercent,
-                                     G1HeapWastePercent);
+                                     G1HeapWastePercent,
+                                     (uint)G1AdaptiveIHOPAllocationRatePercentile);
   } else {
     return new G1StaticIHOPControl(InitiatingHeapOccupancyPercent, old_gen_alloc_tracker);
   }
@@ -991,8 +1025,31 @@ void G1Policy::update_max_gc_locker_expansion() {
   assert(_young_list_target_length <= _young_list_max_length, "post-condition");
 }
 
+// Returns the age after the youngest age of which at least
+// G1TenuringSurvivalPercent of the objects survived the last young collection.
+// Only ages below the tenuring threshold of that collection were copied into
+// survivor regions and can be compared. Without such an age the threshold is
+// raised by at most one per collection, so that it does not flip back and
+// forth between a survival based and the size based threshold.
+uint G1Policy::survival_based_tenuring_threshold(size_t desired_survivor_size,
+                                                 uint prev_tenuring_threshold) const {
+  // Ignore ages with little data, their survival rates are noise.
+  size_t const min_size = MAX2(desired_survivor_size / 100, (size_t)1);
+  for (uint age = 1; age < prev_tenuring_threshold && age + 1 < AgeTable::table_size; age++) {
+    size_t const before = _prev_survivors_age_table.sizes[age];
+    size_t const after = _survivors_age_table.sizes[age + 1];
+    if (before >= min_size && after * 100 >= before * G1TenuringSurvivalPercent) {
+      log_debug(gc, age)("Survival rate of age %u is %1.1f%%, threshold %u",
+                         age, after * 100.0 / before, age + 1);
+      return age + 1;
+    }
+  }
+  return prev_tenuring_threshold + 1;
+}
+
 // Calculates survivor space parameters.
 void G1Policy::update_survivors_policy() {
+  uint const prev_tenuring_threshold = _tenuring_threshold;
   double max_survivor_regions_d =
                  (double) _young_list_target_length / (double) SurvivorRatio;
 
@@ -1003,6 +1060,10 @@ void G1Policy::update_survivors_policy() {
   size_t const survivor_size = desired_survivor_size(desired_max_survivor_regions);
 
   _tenuring_threshold = _survivors_age_table.compute_tenuring_threshold(survivor_size);
+  if (G1TenuringSurvivalPercent > 0) {
+    _tenuring_threshold = MIN2(_tenuring_threshold,
+                               survival_based_tenuring_threshold(survivor_size, prev_tenuring_threshold));
+  }
   if (UsePerfData) {
     _policy_counters->tenuring_threshold()->set_value(_tenuring_threshold);
     _policy_counters->desired_survivor_size()->set_value(survivor_size * oopSize);
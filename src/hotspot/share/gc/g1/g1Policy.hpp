@@ -104,6 +104,12 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Maximum number of workers for the next evacuation pause, derived from
+  // the parallel efficiency of the previous pauses (G1ParallelEfficiencyTarget).
+  uint _evacuation_worker_limit;
+
+  void update_evacuation_worker_limit();
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -244,6 +250,10 @@ private:
 public:
   size_t pending_cards_at_gc_start() const { return _pending_cards_at_gc_start; }
 
+  // Limit the given number of workers for an evacuation pause to the number
+  // that scaled acceptably in the previous pauses.
+  uint calc_evacuation_workers(uint active_workers) const;
+
   // Calculate the minimum number of old regions we'll add to the CSet
   // during a mixed GC.
   uint calc_min_old_cset_length(G1CollectionSetCandidates* candidates) const;
@@ -393,8 +403,13 @@ private:
   uint _max_survivor_regions;
 
   AgeTable _survivors_age_table;
+  // The survivor age table of the young collection before the last one, to
+  // compute survival rates per age.
+  AgeTable _prev_survivors_age_table;
 
   size_t desired_survivor_size(uint max_regions) const;
+  uint survival_based_tenuring_threshold(size_t desired_survivor_size,
+                                         uint prev_tenuring_threshold) const;
 
   // Fraction used when predicting how many optional regions to include in
   // the CSet. This fraction of the available time is used for optional regions,
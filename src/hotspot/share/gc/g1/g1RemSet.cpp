@@ -775,6 +775,7 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   size_t _cards_scanned;
   size_t _blocks_scanned;
   size_t _chunks_claimed;
+  size_t _bot_lookups;
 
   Tickspan _rem_set_root_scan_time;
   Tickspan _rem_set_trim_partially_time;
@@ -783,12 +784,20 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   // card scanning (exclusive).
   HeapWord* _scanned_to;
   G1CardTable::CardValue _scanned_card_value;
+  // Start of a block at or below _scanned_to in the current chunk, or NULL if
+  // no block start has been resolved in this chunk yet. Only the first dirty
+  // card run of a chunk needs a BOT lookup, later runs walk the objects
+  // from here.
+  HeapWord* _block_hint;
 
   HeapWord* scan_memregion(uint region_idx_for_card, MemRegion mr) {
     HeapRegion* const card_region = _g1h->region_at(region_idx_for_card);
     G1ScanCardClosure card_cl(_g1h, _pss);
 
-    HeapWord* const scanned_to = card_region->oops_on_memregion_seq_iterate_careful<true>(mr, &card_cl);
+    if (_block_hint == NULL && !card_region->is_humongous()) {
+      _bot_lookups++;
+    }
+    HeapWord* const scanned_to = card_region->oops_on_memregion_iterate_with_hint(mr, &card_cl, _block_hint);
     assert(scanned_to != NULL, "Should be able to scan range");
     assert(scanned_to >= mr.end(), "Scanned to " PTR_FORMAT " less than range " PTR_FORMAT, p2i(scanned_to), p2i(mr.end()));
 
@@ -839,6 +848,7 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
     _scanned_to = NULL;
 
     while (claim.has_next()) {
+      _block_hint = NULL;
       size_t const region_card_base_idx = ((size_t)region_idx << HeapRegion::LogCardsPerRegion) + claim.value();
       CardTable::CardValue* const base_addr = _ct->byte_for_index(region_card_base_idx);
 
@@ -881,11 +891,13 @@ public:
     _cards_scanned(0),
     _blocks_scanned(0),
     _chunks_claimed(0),
+    _bot_lookups(0),
     _rem_set_root_scan_time(),
     _rem_set_trim_partially_time(),
     _scanned_to(NULL),
     _scanned_card_value(remember_already_scanned_cards ? G1CardTable::g1_scanned_card_val()
-                                                       : G1CardTable::clean_card_val()) {
+                                                       : G1CardTable::clean_card_val()),
+    _block_hint(NULL) {
   }
 
   bool do_heap_region(HeapRegion* r) {
@@ -907,6 +919,7 @@ public:
   size_t cards_scanned() const { return _cards_scanned; }
   size_t blocks_scanned() const { return _blocks_scanned; }
   size_t chunks_claimed() const { return _chunks_claimed; }
+  size_t bot_lookups() const { return _bot_lookups; }
 };
 
 void G1RemSet::scan_heap_roots(G1ParScanThreadState* pss,
@@ -925,6 +938,7 @@ void G1RemSet::scan_heap_roots(G1ParScanThreadState* pss,
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.cards_scanned(), G1GCPhaseTimes::ScanHRScannedCards);
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.blocks_scanned(), G1GCPhaseTimes::ScanHRScannedBlocks);
   p->record_or_add_thread_work_item(scan_phase, worker_id, cl.chunks_claimed(), G1GCPhaseTimes::ScanHRClaimedChunks);
+  p->record_or_add_thread_work_item(scan_phase, worker_id, cl.bot_lookups(), G1GCPhaseTimes::ScanHRBOTLookups);
 }
 
 // Heap region closure to be applied to all regions in the current collection set
@@ -1628,7 +1642,7 @@ void G1RemSet::print_summary_info() {
 class G1RebuildRemSetTask: public AbstractGangTask {
   // Aggregate the counting data that was constructed concurrently
   // with marking.
-  class G1RebuildRemSetHeapRegionClosure : public HeapRegionClosure {
+  class G1RebuildRemSetHeapRegionClosure : public StackObj {
     G1ConcurrentMark* _cm;
     G1RebuildRemSetClosure _update_cl;
 
@@ -1770,101 +1784,114 @@ public:
   G1RebuildRemSetHeapRegionClosure(G1CollectedHeap* g1h,
                                    G1ConcurrentMark* cm,
                                    uint worker_id) :
-    HeapRegionClosure(),
     _cm(cm),
     _update_cl(g1h, worker_id) { }
 
-    bool do_heap_region(HeapRegion* hr) {
+    // Rebuild the remembered set for the chunk_idx'th chunk of the given region.
+    // Returns whether the rebuild has been aborted.
+    bool do_chunk(HeapRegion* hr, size_t chunk_idx, size_t volatile* marked_bytes) {
       if (_cm->has_aborted()) {
         return true;
       }
 
       uint const region_idx = hr->hrm_index();
-      DEBUG_ONLY(HeapWord* const top_at_rebuild_start_check = _cm->top_at_rebuild_start(region_idx);)
-      assert(top_at_rebuild_start_check == NULL ||
-             top_at_rebuild_start_check > hr->bottom(),
+      // Before every chunk (yield point) we need to check whether the region's
+      // TARS changed due to e.g. eager reclaim.
+      HeapWord* const top_at_rebuild_start = _cm->top_at_rebuild_start(region_idx);
+      if (top_at_rebuild_start == NULL) {
+        return false;
+      }
+      assert(top_at_rebuild_start > hr->bottom(),
              "A TARS (" PTR_FORMAT ") == bottom() (" PTR_FORMAT ") indicates the old region %u is empty (%s)",
-             p2i(top_at_rebuild_start_check), p2i(hr->bottom()),  region_idx, hr->get_type_str());
+             p2i(top_at_rebuild_start), p2i(hr->bottom()),  region_idx, hr->get_type_str());
 
-      size_t total_marked_bytes = 0;
       size_t const chunk_size_in_words = G1RebuildRemSetChunkSize / HeapWordSize;
+      HeapWord* const chunk_start = hr->bottom() + chunk_idx * chunk_size_in_words;
 
-      HeapWord* const top_at_mark_start = hr->prev_top_at_mark_start();
-
-      HeapWord* cur = hr->bottom();
-      while (cur < hr->end()) {
-        // After every iteration (yield point) we need to check whether the region's
-        // TARS changed due to e.g. eager reclaim.
-        HeapWord* const top_at_rebuild_start = _cm->top_at_rebuild_start(region_idx);
-        if (top_at_rebuild_start == NULL) {
-          return false;
-        }
-
-        MemRegion next_chunk = MemRegion(hr->bottom(), top_at_rebuild_start).intersection(MemRegion(cur, chunk_size_in_words));
-        if (next_chunk.is_empty()) {
-          break;
-        }
+      MemRegion next_chunk = MemRegion(hr->bottom(), top_at_rebuild_start).intersection(MemRegion(chunk_start, chunk_size_in_words));
+      if (next_chunk.is_empty()) {
+        return false;
+      }
 
-        const Ticks start = Ticks::now();
-        size_t marked_bytes = rebuild_rem_set_in_region(_cm->prev_mark_bitmap(),
-                                                        top_at_mark_start,
-                                                        top_at_rebuild_start,
-                                                        hr,
-                                                        next_chunk);
-        Tickspan time = Ticks::now() - start;
-
-        log_trace(gc, remset, tracking)("Rebuilt region %u "
-                                        "live " SIZE_FORMAT " "
-                                        "time %.3fms "
-                                        "marked bytes " SIZE_FORMAT " "
-                                        "bot " PTR_FORMAT " "
-                                        "TAMS " PTR_FORMAT " "
-                                        "TARS " PTR_FORMAT,
-                                        region_idx,
-                                        _cm->live_bytes(region_idx),
-                                        time.seconds() * 1000.0,
-                                        marked_bytes,
-                                        p2i(hr->bottom()),
-                                        p2i(top_at_mark_start),
-                                        p2i(top_at_rebuild_start));
-
-        if (marked_bytes > 0) {
-          total_marked_bytes += marked_bytes;
-        }
-        cur += chunk_size_in_words;
+      HeapWord* const top_at_mark_start = hr->prev_top_at_mark_start();
 
-        _cm->do_yield_check();
-        if (_cm->has_aborted()) {
-          return true;
-        }
+      const Ticks start = Ticks::now();
+      size_t marked_bytes_in_chunk = rebuild_rem_set_in_region(_cm->prev_mark_bitmap(),
+                                                               top_at_mark_start,
+                                                               top_at_rebuild_start,
+                                                               hr,
+                                                               next_chunk);
+      Tickspan time = Ticks::now() - start;
+
+      log_trace(gc, remset, tracking)("Rebuilt region %u chunk " SIZE_FORMAT " "
+                                      "live " SIZE_FORMAT " "
+                                      "time %.3fms "
+                                      "marked bytes " SIZE_FORMAT " "
+                                      "bot " PTR_FORMAT " "
+                                      "TAMS " PTR_FORMAT " "
+                                      "TARS " PTR_FORMAT,
+                                      region_idx,
+                                      chunk_idx,
+                                      _cm->live_bytes(region_idx),
+                                      time.seconds() * 1000.0,
+                                      marked_bytes_in_chunk,
+                                      p2i(hr->bottom()),
+                                      p2i(top_at_mark_start),
+                                      p2i(top_at_rebuild_start));
+
+      if (marked_bytes_in_chunk > 0) {
+        Atomic::add(marked_bytes, marked_bytes_in_chunk, memory_order_relaxed);
       }
-      // In the final iteration of the loop the region might have been eagerly reclaimed.
-      // Simply filter out those regions. We can not just use region type because there
-      // might have already been new allocations into these regions.
-      DEBUG_ONLY(HeapWord* const top_at_rebuild_start = _cm->top_at_rebuild_start(region_idx);)
-      assert(top_at_rebuild_start == NULL ||
-             total_marked_bytes == hr->marked_bytes(),
-             "Marked bytes " SIZE_FORMAT " for region %u (%s) in [bottom, TAMS) do not match calculated marked bytes " SIZE_FORMAT " "
-             "(" PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT ")",
-             total_marked_bytes, hr->hrm_index(), hr->get_type_str(), hr->marked_bytes(),
-             p2i(hr->bottom()), p2i(top_at_mark_start), p2i(top_at_rebuild_start));
-       // Abort state may have changed after the yield check.
+
+      _cm->do_yield_check();
+      // Abort state may have changed after the yield check.
       return _cm->has_aborted();
     }
   };
 
-  HeapRegionClaimer _hr_claimer;
   G1ConcurrentMark* _cm;
-
   uint _worker_id_offset;
+
+  // Regions that have a TARS, i.e. need to be scanned for the rebuild. Work is
+  // distributed at the granularity of chunks of these regions instead of whole
+  // regions, so that a few large, dense regions do not serialize the rebuild
+  // on few workers while the others are idle.
+  uint* _regions;
+  uint _num_regions;
+
+  size_t _chunks_per_region;
+  size_t volatile _next_chunk;
+
+  // Marked bytes in [bottom, TAMS) per region, accumulated over all chunks.
+  size_t volatile* _marked_bytes;
+
 public:
   G1RebuildRemSetTask(G1ConcurrentMark* cm,
-                      uint n_workers,
                       uint worker_id_offset) :
       AbstractGangTask("G1 Rebuild Remembered Set"),
-      _hr_claimer(n_workers),
       _cm(cm),
-      _worker_id_offset(worker_id_offset) {
+      _worker_id_offset(worker_id_offset),
+      _regions(NULL),
+      _num_regions(0),
+      _chunks_per_region((HeapRegion::GrainBytes + G1RebuildRemSetChunkSize - 1) / G1RebuildRemSetChunkSize),
+      _next_chunk(0),
+      _marked_bytes(NULL) {
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    uint const max_reserved_regions = g1h->max_reserved_regions();
+
+    _regions = NEW_C_HEAP_ARRAY(uint, max_reserved_regions, mtGC);
+    _marked_bytes = NEW_C_HEAP_ARRAY(size_t, max_reserved_regions, mtGC);
+    for (uint i = 0; i < max_reserved_regions; i++) {
+      _marked_bytes[i] = 0;
+      if (_cm->top_at_rebuild_start(i) != NULL) {
+        _regions[_num_regions++] = i;
+      }
+    }
+  }
+
+  ~G1RebuildRemSetTask() {
+    FREE_C_HEAP_ARRAY(uint, _regions);
+    FREE_C_HEAP_ARRAY(size_t, _marked_bytes);
   }
 
   void work(uint worker_id) {
@@ -1873,7 +1900,41 @@ public:
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
     G1RebuildRemSetHeapRegionClosure cl(g1h, _cm, _worker_id_offset + worker_id);
-    g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+
+    size_t const num_chunks = _num_regions * _chunks_per_region;
+    for (size_t claimed = Atomic::fetch_and_add(&_next_chunk, (size_t)1);
+         claimed < num_chunks;
+         claimed = Atomic::fetch_and_add(&_next_chunk, (size_t)1)) {
+      uint const region_idx = _regions[claimed / _chunks_per_region];
+      HeapRegion* hr = g1h->region_at_or_null(region_idx);
+      if (hr == NULL) {
+        continue;
+      }
+      if (cl.do_chunk(hr, claimed % _chunks_per_region, &_marked_bytes[region_idx])) {
+        return;
+      }
+    }
+  }
+
+  void verify_marked_bytes() const {
+    assert(!_cm->has_aborted(), "only verify completed rebuild");
+    G1CollectedHeap* g1h = G1CollectedHeap::heap();
+    for (uint i = 0; i < _num_regions; i++) {
+      uint const region_idx = _regions[i];
+      // The region might have been eagerly reclaimed. Simply filter out those regions.
+      // We can not just use region type because there might have already been new
+      // allocations into these regions.
+      HeapWord* const top_at_rebuild_start = _cm->top_at_rebuild_start(region_idx);
+      if (top_at_rebuild_start == NULL) {
+        continue;
+      }
+      HeapRegion* hr = g1h->region_at(region_idx);
+      assert(_marked_bytes[region_idx] == hr->marked_bytes(),
+             "Marked bytes " SIZE_FORMAT " for region %u (%s) in [bottom, TAMS) do not match calculated marked bytes " SIZE_FORMAT " "
+             "(" PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT ")",
+             _marked_bytes[region_idx], region_idx, hr->get_type_str(), hr->marked_bytes(),
+             p2i(hr->bottom()), p2i(hr->prev_top_at_mark_start()), p2i(top_at_rebuild_start));
+    }
   }
 };
 
@@ -1883,7 +1944,8 @@ void G1RemSet::rebuild_rem_set(G1ConcurrentMark* cm,
   uint num_workers = workers->active_workers();
 
   G1RebuildRemSetTask cl(cm,
-                         num_workers,
                          worker_id_offset);
   workers->run_task(&cl, num_workers);
+
+  DEBUG_ONLY(if (!cm->has_aborted()) { cl.verify_marked_bytes(); })
 }
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1ServiceThread.hpp"
+#include "gc/shared/concurrentGCThreadBudget.hpp"
 #include "logging/log.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/timer.hpp"
@@ -144,7 +145,10 @@ void G1ServiceThread::run_task(G1ServiceTask* task) {
   double vstart = os::elapsedVTime();
 
   log_debug(gc, task, start)("G1 Service Thread (%s) (run)", task->name());
-  task->execute();
+  {
+    ConcurrentGCThreadBudgetSlot budget_slot(ConcurrentGCThreadBudget::Normal);
+    task->execute();
+  }
 
   double duration = os::elapsedTime() - start;
   double vduration = os::elapsedVTime() - vstart;
@@ -51,6 +51,13 @@
           "of the optimal occupancy to start marking.")                     \
           range(1, max_intx)                                                \
                                                                             \
+  product(uintx, G1AdaptiveIHOPAllocationRatePercentile, 0, EXPERIMENTAL,   \
+          "Percentile of the recent old gen allocation rate samples the "   \
+          "adaptive IHOP plans for, to cover allocation bursts. The "       \
+          "average based prediction is used if it is larger. 0 disables "   \
+          "the percentile based prediction.")                               \
+          range(0, 100)                                                     \
+                                                                            \
   product(uintx, G1ConfidencePercent, 50,                                   \
           "Confidence level for MMU/pause predictions")                     \
           range(0, 100)                                                     \
@@ -82,6 +89,19 @@
                "percent.")                                                  \
                range(0.001, 100.0)                                          \
                                                                             \
+  product(uint, G1ParallelEfficiencyTarget, 0, EXPERIMENTAL,                \
+          "Lowest acceptable parallel efficiency of the evacuation phase "  \
+          "in percent. If an evacuation pause scales worse, the next "      \
+          "pauses use fewer workers. 0 disables the limit.")                \
+          range(0, 100)                                                     \
+                                                                            \
+  product(uint, G1TenuringSurvivalPercent, 0, EXPERIMENTAL,                 \
+          "Lower the tenuring threshold to tenure objects one age after "   \
+          "the youngest age of which at least this percentage survived "    \
+          "the last young collection. Such objects are likely to be "       \
+          "copied between survivor regions again. 0 disables this.")        \
+          range(0, 100)                                                     \
+                                                                            \
   product(size_t, G1SATBBufferSize, 1*K,                                    \
           "Number of entries in an SATB log buffer.")                       \
           range(1, max_uintx)                                               \
@@ -174,6 +194,13 @@
           range(0, max_jint/wordSize)                                       \
           constraint(G1RSetSparseRegionEntriesConstraintFunc,AfterErgo)     \
                                                                             \
+  product(uintx, G1RSetFullRegionOccupancyPercent, 90, EXPERIMENTAL,        \
+          "Occupancy of a fine-grain remembered set table, as a "           \
+          "percentage of the cards in a region, at which the table is "     \
+          "replaced by a full-region (coarse) entry. Dense tables give "    \
+          "little precision while costing memory and iteration time.")      \
+          range(1, 100)                                                     \
+                                                                            \
   develop(intx, G1MaxVerifyFailures, -1,                                    \
           "The maximum number of verification failures to print.  "         \
           "-1 means print all.")                                            \
@@ -224,6 +251,14 @@
           "Regions with live bytes exceeding this will not be collected.")  \
           range(0, 100)                                                     \
                                                                             \
+  product(uintx, G1MixedGCRemSetCostThresholdPercent, 100, EXPERIMENTAL,    \
+          "Threshold for regions to be considered for inclusion in the "    \
+          "collection set of mixed GCs, as a percentage of the pause time " \
+          "goal. Regions whose predicted remembered set merge and scan "    \
+          "time exceeds this will not be collected. A value of 0 "          \
+          "disables this check.")                                           \
+          range(0, 100)                                                     \
+                                                                            \
   product(uintx, G1HeapWastePercent, 5,                                     \
           "Amount of space, expressed as a percentage of the heap size, "   \
           "that G1 is willing not to collect to avoid expensive GCs.")      \
@@ -240,6 +275,15 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  product(bool, G1EagerReclaimHumongousObjArrays, true, EXPERIMENTAL,       \
+          "Try to reclaim dead large object arrays at young GCs outside "   \
+          "of concurrent marking.")                                         \
+                                                                            \
+  product(bool, G1ConcurrentPreTouch, false, EXPERIMENTAL,                  \
+          "Touch newly committed free heap regions in the background "      \
+          "instead of leaving it to allocation. Has no effect with "        \
+          "AlwaysPreTouch.")                                                \
+                                                                            \
   product(size_t, G1RebuildRemSetChunkSize, 256 * K, EXPERIMENTAL,          \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
@@ -302,7 +346,14 @@
           "of getloadavg() at which G1 triggers a periodic GC. A load "     \
           "above this value cancels a given periodic GC. A value of zero "  \
           "disables this check.")                                           \
-          range(0.0, (double)max_uintx)
+          range(0.0, (double)max_uintx)                                     \
+                                                                            \
+  product(double, G1PeriodicGCMemoryPressureThreshold, 0.0, MANAGEABLE,     \
+          "Recent system memory pressure (percentage of time some tasks "   \
+          "stalled on memory, Linux PSI) above which G1 triggers a "        \
+          "periodic GC regardless of G1PeriodicGCInterval, at most "        \
+          "every 10 seconds. A value of zero disables this trigger.")       \
+          range(0.0, 100.0)
 
 // end of GC_G1_FLAGS
 
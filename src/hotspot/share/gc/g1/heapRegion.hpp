@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_HEAPREGION_HPP
 
 #include "gc/g1/g1BlockOffsetTable.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
 #include "gc/g1/g1HeapRegionTraceType.hpp"
 #include "gc/g1/g1SurvRateGroup.hpp"
 #include "gc/g1/heapRegionTracer.hpp"
@@ -209,6 +210,9 @@ private:
   // True iff an attempt to evacuate an object in the region failed.
   volatile bool _evacuation_failed;
 
+  // The objects in this region that failed evacuation.
+  G1EvacFailureObjectsSet _evac_failure_objs;
+
   static const uint InvalidCSetIndex = UINT_MAX;
 
   // The index in the optional regions array, if this region
@@ -276,6 +280,16 @@ private:
                                                      Closure* cl,
                                                      G1CollectedHeap* g1h);
 
+  // Iterate over the references covered by the given MemRegion in the non-humongous
+  // objects starting with the block at cur, which must not be above mr.start().
+  // Blocks ending below mr.start() are skipped without scanning them. Sets
+  // last_block to the start of the last block visited.
+  template <class Closure>
+  inline HeapWord* do_oops_on_memregion_from(MemRegion mr,
+                                             Closure* cl,
+                                             HeapWord* cur,
+                                             HeapWord*& last_block);
+
   // Returns the block size of the given (dead, potentially having its class unloaded) object
   // starting at p extending to at most the prev TAMS using the given mark bitmap.
   inline size_t block_size_using_bitmap(const HeapWord* p, const G1CMBitMap* const prev_bitmap) const;
@@ -503,6 +517,12 @@ public:
 
   inline void reset_evacuation_failed();
 
+  // Record an object that failed evacuation within this region.
+  void record_evac_failure_obj(oop obj);
+  // Applies the given closure to all previously recorded objects that failed
+  // evacuation in ascending address order and drops them.
+  void process_and_drop_evac_failure_objs(ObjectClosure* closure);
+
   // Notify the region that we are about to start processing
   // self-forwarded objects during evac failure handling.
   void note_self_forwarding_removal_start(bool during_concurrent_start,
@@ -568,6 +588,15 @@ public:
   template <bool is_gc_active, class Closure>
   inline HeapWord* oops_on_memregion_seq_iterate_careful(MemRegion mr, Closure* cl);
 
+  // As above, but during GC only. For non-humongous regions the walk starts at the
+  // block at hint instead of the block found using the BOT if hint is not NULL.
+  // hint must be a block start at or below mr.start(), and is updated to the start
+  // of the last block visited, which is a valid hint for any later MemRegion
+  // starting at or after the returned address. Humongous regions do not use the
+  // BOT and ignore the hint.
+  template <class Closure>
+  inline HeapWord* oops_on_memregion_iterate_with_hint(MemRegion mr, Closure* cl, HeapWord*& hint);
+
   // Routines for managing a list of code roots (attached to the
   // this region's RSet) that point into this heap region.
   void add_strong_code_root(nmethod* nm);
@@ -353,26 +353,62 @@ HeapWord* HeapRegion::oops_on_memregion_seq_iterate_careful(MemRegion mr,
   // parsable; there's no need to use klass_or_null to detect
   // in-progress allocation.
 
-  // Cache the boundaries of the memory region in some const locals
-  HeapWord* const start = mr.start();
-  HeapWord* const end = mr.end();
-
   // Find the obj that extends onto mr.start().
   // Update BOT as needed while finding start of (possibly dead)
   // object containing the start of the region.
-  HeapWord* cur = block_start(start);
+  HeapWord* cur = block_start(mr.start());
 
 #ifdef ASSERT
   {
-    assert(cur <= start,
-           "cur: " PTR_FORMAT ", start: " PTR_FORMAT, p2i(cur), p2i(start));
+    assert(cur <= mr.start(),
+           "cur: " PTR_FORMAT ", start: " PTR_FORMAT, p2i(cur), p2i(mr.start()));
     HeapWord* next = cur + block_size(cur);
-    assert(start < next,
-           "start: " PTR_FORMAT ", next: " PTR_FORMAT, p2i(start), p2i(next));
+    assert(mr.start() < next,
+           "start: " PTR_FORMAT ", next: " PTR_FORMAT, p2i(mr.start()), p2i(next));
   }
 #endif
 
-  const G1CMBitMap* const bitmap = g1h->concurrent_mark()->prev_mark_bitmap();
+  HeapWord* last_block;
+  return do_oops_on_memregion_from(mr, cl, cur, last_block);
+}
+
+template <class Closure>
+HeapWord* HeapRegion::oops_on_memregion_iterate_with_hint(MemRegion mr,
+                                                          Closure* cl,
+                                                          HeapWord*& hint) {
+  if (is_humongous()) {
+    return do_oops_on_memregion_in_humongous<Closure, true>(mr, cl, G1CollectedHeap::heap());
+  }
+  assert(is_old() || is_archive(), "Wrongly trying to iterate over region %u type %s", _hrm_index, get_type_str());
+  if (hint == NULL) {
+    hint = block_start(mr.start());
+  }
+  assert(hint >= bottom() && hint <= mr.start(),
+         "hint " PTR_FORMAT " must be in region below start " PTR_FORMAT, p2i(hint), p2i(mr.start()));
+  return do_oops_on_memregion_from(mr, cl, hint, hint);
+}
+
+template <class Closure>
+HeapWord* HeapRegion::do_oops_on_memregion_from(MemRegion mr,
+                                                Closure* cl,
+                                                HeapWord* cur,
+                                                HeapWord*& last_block) {
+  // Cache the boundaries of the memory region in some const locals
+  HeapWord* const start = mr.start();
+  HeapWord* const end = mr.end();
+
+  const G1CMBitMap* const bitmap = G1CollectedHeap::heap()->concurrent_mark()->prev_mark_bitmap();
+
+  // Skip the blocks that end before the start of mr.
+  while (true) {
+    size_t size;
+    is_obj_dead_with_size(cast_to_oop(cur), bitmap, &size);
+    if (cur + size > start) {
+      break;
+    }
+    cur += size;
+  }
+
   while (true) {
     oop obj = cast_to_oop(cur);
     assert(oopDesc::is_oop(obj, true), "Not an oop at " PTR_FORMAT, p2i(cur));
@@ -383,6 +419,7 @@ HeapWord* HeapRegion::oops_on_memregion_seq_iterate_careful(MemRegion mr,
     bool is_dead = is_obj_dead_with_size(obj, bitmap, &size);
     bool is_precise = false;
 
+    last_block = cur;
     cur += size;
     if (!is_dead) {
       // Process live object's references.
@@ -116,7 +116,10 @@ HeapRegion* HeapRegionManager::allocate_free_region(HeapRegionType type, uint re
     assert(is_available(hr->hrm_index()), "Must be committed");
 
     if (numa->is_enabled() && hr->node_index() < numa->num_active_nodes()) {
-      numa->update_statistics(G1NUMAStats::NewRegionAlloc, requested_node_index, hr->node_index());
+      G1NUMAStats::NodeDataItems phase = (type.is_survivor() || type.is_old())
+                                         ? G1NUMAStats::NewGCRegionAlloc
+                                         : G1NUMAStats::NewRegionAlloc;
+      numa->update_statistics(phase, requested_node_index, hr->node_index());
     }
   }
 
@@ -66,6 +66,7 @@ size_t OtherRegionsTable::_max_fine_entries = 0;
 size_t OtherRegionsTable::_mod_max_fine_entries_mask = 0;
 size_t OtherRegionsTable::_fine_eviction_stride = 0;
 size_t OtherRegionsTable::_fine_eviction_sample_size = 0;
+size_t OtherRegionsTable::_full_region_occupancy = 0;
 
 OtherRegionsTable::OtherRegionsTable(Mutex* m) :
   _g1h(G1CollectedHeap::heap()),
@@ -77,6 +78,7 @@ OtherRegionsTable::OtherRegionsTable(Mutex* m) :
   _n_fine_entries(0),
   _first_all_fine_prts(NULL),
   _last_all_fine_prts(NULL),
+  _free_fine_prts(NULL),
   _fine_eviction_start(0),
   _sparse_table()
 {
@@ -92,6 +94,8 @@ OtherRegionsTable::OtherRegionsTable(Mutex* m) :
            && _fine_eviction_stride == 0, "All init at same time.");
     _fine_eviction_sample_size = MAX2((size_t)4, max_entries_log);
     _fine_eviction_stride = _max_fine_entries / _fine_eviction_sample_size;
+
+    _full_region_occupancy = MAX2((size_t)1, HeapRegion::CardsPerRegion * G1RSetFullRegionOccupancyPercent / 100);
   }
 
   _fine_grain_regions = NEW_C_HEAP_ARRAY(PerRegionTablePtr, _max_fine_entries, mtGC);
@@ -120,6 +124,41 @@ void OtherRegionsTable::link_to_all(PerRegionTable* prt) {
          "just checking");
 }
 
+void OtherRegionsTable::unlink_from_all(PerRegionTable* prt) {
+  assert(_m->owned_by_self(), "Precondition");
+  PerRegionTable* prev = NULL;
+  PerRegionTable* cur = _first_all_fine_prts;
+  while (cur != prt) {
+    assert(cur != NULL, "PRT " PTR_FORMAT " must be in the 'all' list", p2i(prt));
+    prev = cur;
+    cur = cur->next();
+  }
+  if (prev == NULL) {
+    _first_all_fine_prts = prt->next();
+  } else {
+    prev->set_next(prt->next());
+  }
+  if (_last_all_fine_prts == prt) {
+    _last_all_fine_prts = prev;
+  }
+  prt->set_next(NULL);
+
+  assert((_first_all_fine_prts == NULL && _last_all_fine_prts == NULL) ||
+         (_first_all_fine_prts != NULL && _last_all_fine_prts != NULL),
+         "just checking");
+}
+
+PerRegionTable* OtherRegionsTable::alloc_region_table(HeapRegion* hr) {
+  assert(_m->owned_by_self(), "Precondition");
+  PerRegionTable* prt = _free_fine_prts;
+  if (prt != NULL) {
+    _free_fine_prts = prt->next();
+    prt->init(hr, true /* clear_links_to_all_list */);
+    return prt;
+  }
+  return PerRegionTable::alloc(hr);
+}
+
 CardIdx_t OtherRegionsTable::card_within_region(OopOrNarrowOopStar within_region, HeapRegion* hr) {
   assert(hr->is_in_reserved(within_region),
          "HeapWord " PTR_FORMAT " is outside of region %u [" PTR_FORMAT ", " PTR_FORMAT ")",
@@ -175,7 +214,7 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
         // prt will be reused immediately, i.e. remain in the 'all' list.
         prt->init(from_hr, false /* clear_links_to_all_list */);
       } else {
-        prt = PerRegionTable::alloc(from_hr);
+        prt = alloc_region_table(from_hr);
         link_to_all(prt);
       }
 
@@ -211,11 +250,45 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
   // OtherRegionsTable for why this is OK.
   assert(prt != NULL, "Inv");
 
-  if (prt->add_reference(from)) {
+  bool added = prt->add_reference(from);
+  if (added) {
     num_added_by_coarsening++;
   }
   Atomic::add(&_num_occupied, num_added_by_coarsening, memory_order_relaxed);
   assert(contains_reference(from), "We just added " PTR_FORMAT " to the PRT (%d)", p2i(from), prt->contains_reference(from));
+
+  if (added && (size_t)prt->occupied() >= _full_region_occupancy) {
+    coarsen_dense_region_table(ind, from_hr);
+  }
+}
+
+void OtherRegionsTable::coarsen_dense_region_table(size_t ind, HeapRegion* hr) {
+  MutexLocker x(_m, Mutex::_no_safepoint_check_flag);
+
+  // Re-find the table while holding the lock; it may have been coarsened
+  // or reused for a different region concurrently.
+  PerRegionTable** prev = &_fine_grain_regions[ind];
+  PerRegionTable* prt = *prev;
+  while (prt != NULL && prt->hr() != hr) {
+    prev = prt->collision_list_next_addr();
+    prt = prt->collision_list_next();
+  }
+  if (prt == NULL || (size_t)prt->occupied() < _full_region_occupancy) {
+    return;
+  }
+
+  // Set the coarse bit before unlinking so that concurrent adders that still
+  // hold on to this table never lose a card.
+  add_coarse_entry(hr->hrm_index());
+  Atomic::add(&_num_occupied, HeapRegion::CardsPerRegion - prt->occupied(), memory_order_relaxed);
+
+  *prev = prt->collision_list_next();
+  _n_fine_entries--;
+  unlink_from_all(prt);
+  prt->set_next(_free_fine_prts);
+  _free_fine_prts = prt;
+
+  Atomic::inc(&_n_coarsenings);
 }
 
 PerRegionTable*
@@ -273,26 +346,30 @@ PerRegionTable* OtherRegionsTable::delete_region_table(size_t& added_by_deleted)
   guarantee(max_prev != NULL, "Since max != NULL.");
 
   // Ensure the corresponding coarse bit is set.
-  size_t max_hrm_index = (size_t) max->hr()->hrm_index();
+  add_coarse_entry((size_t) max->hr()->hrm_index());
+
+  added_by_deleted = HeapRegion::CardsPerRegion - max_occ;
+  // Unsplice.
+  *max_prev = max->collision_list_next();
+  Atomic::inc(&_n_coarsenings);
+  _n_fine_entries--;
+  return max;
+}
+
+void OtherRegionsTable::add_coarse_entry(size_t hrm_index) {
+  assert(_m->owned_by_self(), "Precondition");
   if (Atomic::load(&_has_coarse_entries)) {
-    _coarse_map.at_put(max_hrm_index, true);
+    _coarse_map.at_put(hrm_index, true);
   } else {
     // This will lazily initialize an uninitialized bitmap
     _coarse_map.reinitialize(G1CollectedHeap::heap()->max_reserved_regions());
-    assert(!_coarse_map.at(max_hrm_index), "No coarse entries");
-    _coarse_map.at_put(max_hrm_index, true);
+    assert(!_coarse_map.at(hrm_index), "No coarse entries");
+    _coarse_map.at_put(hrm_index, true);
     // Release store guarantees that the bitmap has initialized before any
     // concurrent reader will ever see _has_coarse_entries is true
     // (when read with load_acquire)
     Atomic::release_store(&_has_coarse_entries, true);
   }
-
-  added_by_deleted = HeapRegion::CardsPerRegion - max_occ;
-  // Unsplice.
-  *max_prev = max->collision_list_next();
-  Atomic::inc(&_n_coarsenings);
-  _n_fine_entries--;
-  return max;
 }
 
 bool OtherRegionsTable::occupancy_less_or_equal_than(size_t limit) const {
@@ -315,6 +392,9 @@ size_t OtherRegionsTable::mem_size() const {
       _first_all_fine_prts->mem_size() == _last_all_fine_prts->mem_size(), "check that mem_size() is constant");
     sum += _first_all_fine_prts->mem_size() * _n_fine_entries;
   }
+  for (PerRegionTable* cur = _free_fine_prts; cur != NULL; cur = cur->next()) {
+    sum += cur->mem_size();
+  }
   sum += (sizeof(PerRegionTable*) * _max_fine_entries);
   sum += (_coarse_map.size_in_words() * HeapWordSize);
   sum += (_sparse_table.mem_size());
@@ -341,6 +421,16 @@ void OtherRegionsTable::clear() {
   }
 
   _first_all_fine_prts = _last_all_fine_prts = NULL;
+
+  if (_free_fine_prts != NULL) {
+    PerRegionTable* last = _free_fine_prts;
+    while (last->next() != NULL) {
+      last = last->next();
+    }
+    PerRegionTable::bulk_free(_free_fine_prts, last);
+    _free_fine_prts = NULL;
+  }
+
   _sparse_table.clear();
   if (Atomic::load(&_has_coarse_entries)) {
     _coarse_map.clear();
@@ -53,6 +53,13 @@ class nmethod;
 // deleting an entry and setting the corresponding coarse-grained bit when
 // we would overflow this cap.
 
+// A fine-grain table whose occupancy reaches G1RSetFullRegionOccupancyPercent
+// of the cards of its region is replaced by a coarse entry for that region
+// early: such dense tables give little precision but cost a full bitmap
+// of memory and are more expensive to iterate than a single coarse bit.
+// The replaced table is kept on a table-local free list for reuse by
+// this remembered set only, see below.
+
 // We use a mixture of locking and lock-free techniques here.  We allow
 // threads to locate PRTs without locking, but threads attempting to alter
 // a bucket list obtain a lock.  This means that any failing attempt to
@@ -89,6 +96,12 @@ class OtherRegionsTable {
   PerRegionTable * _first_all_fine_prts;
   PerRegionTable * _last_all_fine_prts;
 
+  // Fine grain remembered sets that were replaced by a coarse entry because
+  // they became too dense. Concurrent readers may still be looking at them,
+  // so they are only reused for this table, and returned to the global free
+  // list when the table is cleared. Protected by "_m".
+  PerRegionTable * _free_fine_prts;
+
   // Used to sample a subset of the fine grain PRTs to determine which
   // PRT to evict and coarsen.
   size_t        _fine_eviction_start;
@@ -100,6 +113,7 @@ class OtherRegionsTable {
   // These are static after init.
   static size_t _max_fine_entries;
   static size_t _mod_max_fine_entries_mask;
+  static size_t _full_region_occupancy;
 
   // Requires "prt" to be the first element of the bucket list appropriate
   // for "hr".  If this list contains an entry for "hr", return it,
@@ -111,8 +125,21 @@ class OtherRegionsTable {
   // to hold _m, and the fine-grain table to be full.
   PerRegionTable* delete_region_table(size_t& added_by_deleted);
 
+  // Set the coarse bit for the given region. Requires the caller to hold _m.
+  void add_coarse_entry(size_t hrm_index);
+
+  // If the fine-grain table for "hr" in bucket "ind" is still dense enough,
+  // replace it by a coarse entry and move it to _free_fine_prts.
+  void coarsen_dense_region_table(size_t ind, HeapRegion* hr);
+
+  // Returns an initialized PerRegionTable for "hr", preferring tables
+  // previously retired from this remembered set.
+  PerRegionTable* alloc_region_table(HeapRegion* hr);
+
   // link/add the given fine grain remembered set into the "all" list
   void link_to_all(PerRegionTable * prt);
+  // unlink the given fine grain remembered set from the "all" list
+  void unlink_from_all(PerRegionTable * prt);
 
   bool contains_reference_locked(OopOrNarrowOopStar from) const;
 
@@ -29,9 +29,11 @@
 #include "gc/parallel/psPromotionManager.inline.hpp"
 #include "gc/parallel/psScavenge.inline.hpp"
 #include "gc/parallel/psYoungGen.hpp"
+#include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 
@@ -126,61 +128,151 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
 // when the space is empty, fix the calculation of
 // end_card to allow sp_top == sp->bottom().
 
-// The generation (old gen) is divided into slices, which are further
-// subdivided into stripes, with one stripe per GC thread. The size of
-// a stripe is a constant, ssize.
+// The generation (old gen) is divided into stripes of a constant size,
+// ssize cards. The stripes are handed out by a PSStripeClaimer, in address
+// order, to whichever GC thread asks for work first.
 //
-//      +===============+        slice 0
-//      |  stripe 0     |
 //      +---------------+
-//      |  stripe 1     |
+//      |  stripe 0     |   <- claimed by thread 2
 //      +---------------+
-//      |  stripe 2     |
+//      |  stripe 1     |   <- claimed by thread 0
 //      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 1
-//      |  stripe 0     |
+//      |  stripe 2     |   <- claimed by thread 1
 //      +---------------+
-//      |  stripe 1     |
+//      |  stripe 3     |   <- claimed by thread 0
 //      +---------------+
-//      |  stripe 2     |
-//      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes.  The next
-// stripe is at ssize * number_of_stripes (= slice_stride)..  So after
-// finishing stripe 0 in slice 0, the thread finds the stripe 0 in slice1 by
-// adding slice_stride to the start of stripe 0 in slice 0 to get to the start
-// of stride 0 in slice 1.
+// A thread keeps claiming stripes until they are exhausted, so threads that
+// only find clean cards pick up more stripes than a thread that is busy with
+// a densely dirtied stripe. Each object belongs to the stripe its header is
+// in, and is scanned as far as it reaches, even into the following stripes.
+// The exception is an object array that is larger than a stripe. Such an
+// array is split between the stripes it spans, and each of them scans only
+// the dirty part of the array that it covers. Card marks for object arrays
+// are precise, so this finds all old-to-young pointers in the array.
+
+PSStripeClaimer::PSStripeClaimer(uint num_workers) :
+  _next_stripe(0),
+  _num_workers(num_workers),
+  _stripes(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)),
+  _scanned_cards(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)) {
+  for (uint i = 0; i < num_workers; i++) {
+    _stripes[i] = 0;
+    _scanned_cards[i] = 0;
+  }
+}
+
+PSStripeClaimer::~PSStripeClaimer() {
+  FREE_C_HEAP_ARRAY(size_t, _stripes);
+  FREE_C_HEAP_ARRAY(size_t, _scanned_cards);
+}
+
+uint PSStripeClaimer::claim() {
+  return Atomic::fetch_and_add(&_next_stripe, 1u);
+}
+
+void PSStripeClaimer::record(uint worker_id, size_t stripes, size_t scanned_cards) {
+  assert(worker_id < _num_workers, "Invalid worker id %u", worker_id);
+  _stripes[worker_id] = stripes;
+  _scanned_cards[worker_id] = scanned_cards;
+}
+
+void PSStripeClaimer::print_stats() const {
+  LogTarget(Debug, gc, phases) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  size_t total_stripes = 0;
+  size_t min_stripes = SIZE_MAX;
+  size_t max_stripes = 0;
+  size_t total_cards = 0;
+  size_t min_cards = SIZE_MAX;
+  size_t max_cards = 0;
+  for (uint i = 0; i < _num_workers; i++) {
+    total_stripes += _stripes[i];
+    min_stripes = MIN2(min_stripes, _stripes[i]);
+    max_stripes = MAX2(max_stripes, _stripes[i]);
+    total_cards += _scanned_cards[i];
+    min_cards = MIN2(min_cards, _scanned_cards[i]);
+    max_cards = MAX2(max_cards, _scanned_cards[i]);
+  }
+
+  lt.print("Old Gen Card Scan: Stripes: " SIZE_FORMAT " (Min: " SIZE_FORMAT ", Max: " SIZE_FORMAT "), "
+           "Scanned Cards: " SIZE_FORMAT " (Min: " SIZE_FORMAT ", Max: " SIZE_FORMAT "), Workers: %u",
+           total_stripes, min_stripes, max_stripes,
+           total_cards, min_cards, max_cards, _num_workers);
+}
+
+// Looks up object starts, remembering the last object found. Lookups within
+// a large object, such as an array split between stripes, would otherwise
+// walk the start array back to the object header every time.
+class PSObjectStartCache : public StackObj {
+  ObjectStartArray* const _start_array;
+  HeapWord*               _start;
+  HeapWord*               _end;
+
+public:
+  PSObjectStartCache(ObjectStartArray* start_array) :
+    _start_array(start_array),
+    _start(NULL),
+    _end(NULL) { }
+
+  HeapWord* object_start(HeapWord* addr) {
+    if (_start <= addr && addr < _end) {
+      return _start;
+    }
+    _start = _start_array->object_start(addr);
+    _end = _start + cast_to_oop(_start)->size();
+    return _start;
+  }
+};
+
+static bool is_split_array(HeapWord* addr, size_t stripe_words) {
+  oop obj = cast_to_oop(addr);
+  return PSChunkLargeArrays && obj->is_objArray() && obj->size() > stripe_words;
+}
+
+// Scans the object at p and returns the address up to which it was scanned.
+// Of an array split between stripes, only the part in [dirty_start, to) is
+// scanned.
+static oop* scan_object(PSPromotionManager* pm, oop* p, HeapWord* dirty_start, oop* to, size_t stripe_words) {
+  oop m = cast_to_oop(p);
+  assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
+  oop* end = p + m->size();
+  if (is_split_array((HeapWord*)p, stripe_words)) {
+    oop* left = MAX2(p, (oop*)dirty_start);
+    oop* right = MIN2(end, to);
+    pm->push_contents_bounded(m, (HeapWord*)left, (HeapWord*)right);
+    return right;
+  }
+  pm->push_contents(m);
+  return end;
+}
 
 void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              MutableSpace* sp,
                                              HeapWord* space_top,
                                              PSPromotionManager* pm,
-                                             uint stripe_number,
-                                             uint stripe_total) {
+                                             PSStripeClaimer* claimer,
+                                             uint worker_id) {
   int ssize = 128; // Naked constant!  Work unit = 64k.
-  int dirty_card_count = 0;
+  const size_t stripe_words = ssize * card_size_in_words;
+  size_t stripe_count = 0;
+  size_t scanned_card_count = 0;
 
   // It is a waste to get here if empty.
   assert(sp->bottom() < sp->top(), "Should not be called if empty");
   oop* sp_top = (oop*)space_top;
   CardValue* start_card = byte_for(sp->bottom());
   CardValue* end_card   = byte_for(sp_top - 1) + 1;
+  const size_t num_cards = pointer_delta(end_card, start_card, sizeof(CardValue));
   oop* last_scanned = NULL; // Prevent scanning objects more than once
-  // The width of the stripe ssize*stripe_total must be
-  // consistent with the number of stripes so that the complete slice
-  // is covered.
-  size_t slice_width = ssize * stripe_total;
-  for (CardValue* slice = start_card; slice < end_card; slice += slice_width) {
-    CardValue* worker_start_card = slice + stripe_number * ssize;
-    if (worker_start_card >= end_card)
-      return; // We're done.
+  PSObjectStartCache object_starts(start_array);
+  for (uint stripe = claimer->claim(); (size_t)stripe * ssize < num_cards; stripe = claimer->claim()) {
+    CardValue* worker_start_card = start_card + (size_t)stripe * ssize;
+    stripe_count++;
 
     CardValue* worker_end_card = worker_start_card + ssize;
     if (worker_end_card > end_card)
@@ -199,36 +291,53 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     if (GCWorkerDelayMillis > 0) {
       // Delay 1 worker so that it proceeds after all the work
       // has been completed.
-      if (stripe_number < 2) {
+      if (worker_id < 2) {
         os::naked_sleep(GCWorkerDelayMillis);
       }
     }
 #endif
 
-    // If there are not objects starting within the chunk, skip it.
+    // If there are not objects starting within the chunk, skip it. The
+    // exception is a dirty part of an array split between stripes.
     if (!start_array->object_starts_in_range(slice_start, slice_end)) {
-      continue;
+      CardValue* card = worker_start_card;
+      while (card < worker_end_card && card_is_clean(*card)) {
+        card++;
+      }
+      if (card == worker_end_card ||
+          !is_split_array(object_starts.object_start(slice_start), stripe_words)) {
+        continue;
+      }
     }
     // Update our beginning addr
-    HeapWord* first_object = start_array->object_start(slice_start);
+    HeapWord* first_object = object_starts.object_start(slice_start);
     debug_only(oop* first_object_within_slice = (oop*) first_object;)
     if (first_object < slice_start) {
-      last_scanned = (oop*)(first_object + cast_to_oop(first_object)->size());
-      debug_only(first_object_within_slice = last_scanned;)
-      worker_start_card = byte_for(last_scanned);
+      if (is_split_array(first_object, stripe_words)) {
+        // Scan our part of the array.
+        last_scanned = (oop*)first_object;
+      } else {
+        last_scanned = (oop*)(first_object + cast_to_oop(first_object)->size());
+        debug_only(first_object_within_slice = last_scanned;)
+        worker_start_card = byte_for(last_scanned);
+      }
     }
 
     // Update the ending addr
     if (slice_end < (HeapWord*)sp_top) {
       // The subtraction is important! An object may start precisely at slice_end.
-      HeapWord* last_object = start_array->object_start(slice_end - 1);
-      slice_end = last_object + cast_to_oop(last_object)->size();
-      // worker_end_card is exclusive, so bump it one past the end of last_object's
-      // covered span.
-      worker_end_card = byte_for(slice_end) + 1;
-
-      if (worker_end_card > end_card)
-        worker_end_card = end_card;
+      HeapWord* last_object = object_starts.object_start(slice_end - 1);
+      // The rest of an array split between stripes is scanned by the
+      // following stripes.
+      if (!is_split_array(last_object, stripe_words)) {
+        slice_end = last_object + cast_to_oop(last_object)->size();
+        // worker_end_card is exclusive, so bump it one past the end of last_object's
+        // covered span.
+        worker_end_card = byte_for(slice_end) + 1;
+
+        if (worker_end_card > end_card)
+          worker_end_card = end_card;
+      }
     }
 
     assert(slice_end <= (HeapWord*)sp_top, "Last object in slice crosses space boundary");
@@ -258,35 +367,43 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
           // an object has more than one dirty card, separated by a clean card,
           // we will attempt to scan it twice. The test against "last_scanned"
           // prevents the redundant object scan, but it does not prevent newly
-          // marked cards from being cleaned.
-          HeapWord* last_object_in_dirty_region = start_array->object_start(addr_for(current_card)-1);
-          size_t size_of_last_object = cast_to_oop(last_object_in_dirty_region)->size();
-          HeapWord* end_of_last_object = last_object_in_dirty_region + size_of_last_object;
-          CardValue* ending_card_of_last_object = byte_for(end_of_last_object);
-          assert(ending_card_of_last_object <= worker_end_card, "ending_card_of_last_object is greater than worker_end_card");
-          if (ending_card_of_last_object > current_card) {
-            // This means the object spans the next complete card.
-            // We need to bump the current_card to ending_card_of_last_object
-            current_card = ending_card_of_last_object;
+          // marked cards from being cleaned. Only the dirty cards of an array
+          // split between stripes are scanned, so the run is not extended over
+          // the rest of such an array.
+          HeapWord* last_object_in_dirty_region = object_starts.object_start(addr_for(current_card)-1);
+          if (!is_split_array(last_object_in_dirty_region, stripe_words)) {
+            size_t size_of_last_object = cast_to_oop(last_object_in_dirty_region)->size();
+            HeapWord* end_of_last_object = last_object_in_dirty_region + size_of_last_object;
+            CardValue* ending_card_of_last_object = byte_for(end_of_last_object);
+            assert(ending_card_of_last_object <= worker_end_card, "ending_card_of_last_object is greater than worker_end_card");
+            if (ending_card_of_last_object > current_card) {
+              // This means the object spans the next complete card.
+              // We need to bump the current_card to ending_card_of_last_object
+              current_card = ending_card_of_last_object;
+            }
           }
         }
       }
       CardValue* following_clean_card = current_card;
 
       if (first_unclean_card < worker_end_card) {
-        oop* p = (oop*) start_array->object_start(addr_for(first_unclean_card));
-        assert((HeapWord*)p <= addr_for(first_unclean_card), "checking");
+        scanned_card_count += pointer_delta(following_clean_card, first_unclean_card, sizeof(CardValue));
+        HeapWord* dirty_start = addr_for(first_unclean_card);
+        oop* p = (oop*) object_starts.object_start(dirty_start);
+        assert((HeapWord*)p <= dirty_start, "checking");
         // "p" should always be >= "last_scanned" because newly GC dirtied
         // cards are no longer scanned again (see comment at end
         // of loop on the increment of "current_card").  Test that
         // hypothesis before removing this code.
         // If this code is removed, deal with the first time through
         // the loop when the last_scanned is the object starting in
-        // the previous slice.
+        // the previous slice. An array split between stripes is scanned
+        // piecewise, so "last_scanned" may point into it.
         assert((p >= last_scanned) ||
-               (last_scanned == first_object_within_slice),
+               (last_scanned == first_object_within_slice) ||
+               is_split_array((HeapWord*)p, stripe_words),
                "Should no longer be possible");
-        if (p < last_scanned) {
+        if (p < last_scanned && !is_split_array((HeapWord*)p, stripe_words)) {
           // Avoid scanning more than once; this can happen because
           // newgen cards set by GC may a different set than the
           // originally dirty set
@@ -316,18 +433,12 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
         if (interval != 0) {
           while (p < to) {
             Prefetch::write(p, interval);
-            oop m = cast_to_oop(p);
-            assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
-            pm->push_contents(m);
-            p += m->size();
+            p = scan_object(pm, p, dirty_start, to, stripe_words);
           }
           pm->drain_stacks_cond_depth();
         } else {
           while (p < to) {
-            oop m = cast_to_oop(p);
-            assert(oopDesc::is_oop_or_null(m), "Expected an oop or NULL for header field at " PTR_FORMAT, p2i(m));
-            pm->push_contents(m);
-            p += m->size();
+            p = scan_object(pm, p, dirty_start, to, stripe_words);
           }
           pm->drain_stacks_cond_depth();
         }
@@ -347,6 +458,8 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
       current_card++;
     }
   }
+
+  claimer->record(worker_id, stripe_count, scanned_card_count);
 }
 
 // This should be called before a scavenge.
@@ -32,6 +32,26 @@ class MutableSpace;
 class ObjectStartArray;
 class PSPromotionManager;
 
+// Hands out the stripes of the old generation that are scanned for
+// old-to-young pointers during a scavenge. Stripes are claimed on demand,
+// so workers that run into clean stripes move on to work that would
+// otherwise be left to a worker stuck in a densely dirtied area. Per-worker
+// counts are kept to report how evenly the work was spread.
+class PSStripeClaimer : public StackObj {
+  volatile uint _next_stripe;
+  uint const    _num_workers;
+  size_t*       _stripes;
+  size_t*       _scanned_cards;
+
+public:
+  PSStripeClaimer(uint num_workers);
+  ~PSStripeClaimer();
+
+  uint claim();
+  void record(uint worker_id, size_t stripes, size_t scanned_cards);
+  void print_stats() const;
+};
+
 class PSCardTable: public CardTable {
  private:
   // Support methods for resizing the card table.
@@ -61,8 +81,8 @@ class PSCardTable: public CardTable {
                                   MutableSpace* sp,
                                   HeapWord* space_top,
                                   PSPromotionManager* pm,
-                                  uint stripe_number,
-                                  uint stripe_total);
+                                  PSStripeClaimer* claimer,
+                                  uint worker_id);
 
   bool addr_is_marked_imprecise(void *addr);
   bool addr_is_marked_precise(void *addr);
@@ -210,7 +210,7 @@ bool PSOldGen::expand(size_t bytes) {
   if (UseNUMA) {
     // With NUMA we use round-robin page allocation for the old gen. Expand by at least
     // providing a page per lgroup. Alignment is larger or equal to the page size.
-    aligned_expand_bytes = MAX2(aligned_expand_bytes, alignment * os::numa_get_groups_num());
+    aligned_expand_bytes = MAX2(aligned_expand_bytes, numa_alignment());
   }
   if (aligned_bytes == 0) {
     // The alignment caused the number of bytes to wrap.  A call to expand
@@ -290,19 +290,26 @@ void PSOldGen::shrink(size_t bytes) {
   assert_lock_strong(ExpandHeap_lock);
   assert_locked_or_safepoint(Heap_lock);
 
-  size_t size = align_down(bytes, virtual_space()->alignment());
+  // With NUMA, shrink by whole pages per lgroup so that every lgroup keeps
+  // an equal share of the interleaved old gen.
+  size_t size = align_down(bytes, UseNUMA ? numa_alignment() : virtual_space()->alignment());
   if (size > 0) {
     assert_lock_strong(ExpandHeap_lock);
-    virtual_space()->shrink_by(bytes);
+    virtual_space()->shrink_by(size);
     post_resize();
 
     size_t new_mem_size = virtual_space()->committed_size();
-    size_t old_mem_size = new_mem_size + bytes;
+    size_t old_mem_size = new_mem_size + size;
     log_debug(gc)("Shrinking %s from " SIZE_FORMAT "K by " SIZE_FORMAT "K to " SIZE_FORMAT "K",
-                  name(), old_mem_size/K, bytes/K, new_mem_size/K);
+                  name(), old_mem_size/K, size/K, new_mem_size/K);
   }
 }
 
+size_t PSOldGen::numa_alignment() const {
+  assert(UseNUMA, "only for NUMA");
+  return virtual_space()->alignment() * os::numa_get_groups_num();
+}
+
 void PSOldGen::resize(size_t desired_free_space) {
   const size_t alignment = virtual_space()->alignment();
   const size_t size_before = virtual_space()->committed_size();
@@ -332,6 +339,11 @@ void PSOldGen::resize(size_t desired_free_space) {
   }
   if (new_size > current_size) {
     size_t change_bytes = new_size - current_size;
+    if (UseNUMA) {
+      // Grow by whole pages per lgroup, as long as the reserved space allows.
+      change_bytes = MIN2(align_up(change_bytes, numa_alignment()),
+                          virtual_space()->uncommitted_size());
+    }
     MutexLocker x(ExpandHeap_lock);
     expand(change_bytes);
   } else {
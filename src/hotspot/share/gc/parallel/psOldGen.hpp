@@ -86,6 +86,9 @@ class PSOldGen : public CHeapObj<mtGC> {
 
   void shrink(size_t bytes);
 
+  // Granularity at which the old gen is resized with NUMA: a page per lgroup.
+  size_t numa_alignment() const;
+
   void post_resize();
 
   void initialize(ReservedSpace rs, size_t initial_size, size_t alignment,
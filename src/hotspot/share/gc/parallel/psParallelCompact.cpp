@@ -558,22 +558,23 @@ ParallelCompactData::summarize_dense_prefix(HeapWord* beg, HeapWord* end)
   assert(is_region_aligned(beg), "not RegionSize aligned");
   assert(is_region_aligned(end), "not RegionSize aligned");
 
-  size_t cur_region = addr_to_region_idx(beg);
   const size_t end_region = addr_to_region_idx(end);
-  HeapWord* addr = beg;
-  while (cur_region < end_region) {
-    _region_data[cur_region].set_destination(addr);
-    _region_data[cur_region].set_destination_count(0);
-    _region_data[cur_region].set_source_region(cur_region);
-    _region_data[cur_region].set_data_location(addr);
+  for (size_t cur_region = addr_to_region_idx(beg); cur_region < end_region; ++cur_region) {
+    summarize_dense_prefix_region(cur_region);
+  }
+}
 
-    // Update live_obj_size so the region appears completely full.
-    size_t live_size = RegionSize - _region_data[cur_region].partial_obj_size();
-    _region_data[cur_region].set_live_obj_size(live_size);
+void ParallelCompactData::summarize_dense_prefix_region(size_t cur_region)
+{
+  HeapWord* const addr = region_to_addr(cur_region);
+  _region_data[cur_region].set_destination(addr);
+  _region_data[cur_region].set_destination_count(0);
+  _region_data[cur_region].set_source_region(cur_region);
+  _region_data[cur_region].set_data_location(addr);
 
-    ++cur_region;
-    addr += RegionSize;
-  }
+  // Update live_obj_size so the region appears completely full.
+  size_t live_size = RegionSize - _region_data[cur_region].partial_obj_size();
+  _region_data[cur_region].set_live_obj_size(live_size);
 }
 
 // Find the point at which a space can be split and, if necessary, record the
@@ -715,51 +716,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+      summarize_region(split_info, cur_region, dest_addr, words);
       dest_addr += words;
     }
 
@@ -770,6 +727,56 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region(SplitInfo& split_info, size_t cur_region,
+                                           HeapWord* dest_addr, size_t words)
+{
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) const {
   assert(addr != NULL, "Should detect NULL oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
@@ -1430,15 +1437,173 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   return sd.region_to_addr(best_cp);
 }
 
+// Summarizes a range of regions with the parallel workers.  The destination
+// of a region is the destination of the range plus the live data of all
+// regions to its left, so the destinations are computed as a prefix sum over
+// chunks of regions: the workers first add up the live data of each chunk,
+// the chunk sums are then accumulated serially, and the workers finally
+// summarize the regions of each chunk starting at its destination.
+// Regions that belong to the dense prefix are independent of each other and
+// are summarized in a single pass.
+class PSSummarizeRegionsTask : public AbstractGangTask {
+  typedef ParallelCompactData::RegionData RegionData;
+
+public:
+  enum Step {
+    SumChunks,
+    SummarizeChunks,
+    SummarizeDensePrefix
+  };
+
+  static const size_t ChunkRegions = 1024;
+
+private:
+  ParallelCompactData& _sd;
+  SplitInfo* const     _split_info;
+  const size_t         _beg_region;
+  const size_t         _end_region;
+  const size_t         _num_chunks;
+  // Live words per chunk, then live words to the left of each chunk.
+  size_t* const        _chunk_words;
+  Step                 _step;
+  HeapWord*            _target_beg;
+  volatile size_t      _claimed;
+
+  size_t chunk_beg(size_t chunk) const { return _beg_region + chunk * ChunkRegions; }
+  size_t chunk_end(size_t chunk) const { return MIN2(chunk_beg(chunk) + ChunkRegions, _end_region); }
+
+  void sum_chunk(size_t chunk) {
+    size_t words = 0;
+    for (size_t region = chunk_beg(chunk); region < chunk_end(chunk); ++region) {
+      words += _sd.region(region)->data_size();
+    }
+    _chunk_words[chunk] = words;
+  }
+
+  void summarize_chunk(size_t chunk) {
+    HeapWord* dest_addr = _target_beg + _chunk_words[chunk];
+    for (size_t region = chunk_beg(chunk); region < chunk_end(chunk); ++region) {
+      RegionData* const region_ptr = _sd.region(region);
+      // The destination must be set even if the region has no data.
+      region_ptr->set_destination(dest_addr);
+      const size_t words = region_ptr->data_size();
+      if (words > 0) {
+        _sd.summarize_region(*_split_info, region, dest_addr, words);
+        dest_addr += words;
+      }
+    }
+  }
+
+  void summarize_dense_prefix_chunk(size_t chunk) {
+    for (size_t region = chunk_beg(chunk); region < chunk_end(chunk); ++region) {
+      _sd.summarize_dense_prefix_region(region);
+    }
+  }
+
+public:
+  PSSummarizeRegionsTask(SplitInfo* split_info, size_t beg_region, size_t end_region) :
+    AbstractGangTask("PSSummarizeRegionsTask"),
+    _sd(PSParallelCompact::summary_data()),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _num_chunks(num_chunks(beg_region, end_region)),
+    _chunk_words(NEW_C_HEAP_ARRAY(size_t, _num_chunks, mtGC)),
+    _step(SumChunks),
+    _target_beg(NULL),
+    _claimed(0) { }
+
+  ~PSSummarizeRegionsTask() {
+    FREE_C_HEAP_ARRAY(size_t, _chunk_words);
+  }
+
+  static size_t num_chunks(size_t beg_region, size_t end_region) {
+    return (end_region - beg_region + ChunkRegions - 1) / ChunkRegions;
+  }
+
+  void set_step(Step step, HeapWord* target_beg) {
+    _step = step;
+    _target_beg = target_beg;
+    _claimed = 0;
+  }
+
+  // Turn the live words per chunk into the live words to the left of each
+  // chunk, and return the total.
+  size_t accumulate_chunks() {
+    size_t total = 0;
+    for (size_t chunk = 0; chunk < _num_chunks; ++chunk) {
+      const size_t words = _chunk_words[chunk];
+      _chunk_words[chunk] = total;
+      total += words;
+    }
+    return total;
+  }
+
+  virtual void work(uint worker_id) {
+    for (size_t chunk = Atomic::fetch_and_add(&_claimed, size_t(1));
+         chunk < _num_chunks;
+         chunk = Atomic::fetch_and_add(&_claimed, size_t(1))) {
+      switch (_step) {
+        case SumChunks:            sum_chunk(chunk); break;
+        case SummarizeChunks:      summarize_chunk(chunk); break;
+        case SummarizeDensePrefix: summarize_dense_prefix_chunk(chunk); break;
+        default:                   ShouldNotReachHere();
+      }
+    }
+  }
+};
+
+static bool should_summarize_in_parallel(size_t beg_region, size_t end_region) {
+  return ParallelScavengeHeap::heap()->workers().active_workers() > 1 &&
+         PSSummarizeRegionsTask::num_chunks(beg_region, end_region) > 1;
+}
+
+void PSParallelCompact::summarize_fitting(SplitInfo& split_info,
+                                          HeapWord* source_beg, HeapWord* source_end,
+                                          HeapWord* target_beg, HeapWord* target_end,
+                                          HeapWord** target_next)
+{
+  const size_t beg_region = _summary_data.addr_to_region_idx(source_beg);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(source_end));
+  if (!should_summarize_in_parallel(beg_region, end_region)) {
+    bool result = _summary_data.summarize(split_info,
+                                          source_beg, source_end, NULL,
+                                          target_beg, target_end, target_next);
+    assert(result, "source must fit into target");
+    return;
+  }
+
+  PSSummarizeRegionsTask task(&split_info, beg_region, end_region);
+  ParallelScavengeHeap::heap()->workers().run_task(&task);
+  const size_t total_words = task.accumulate_chunks();
+  assert(target_beg + total_words <= target_end, "source must fit into target");
+  task.set_step(PSSummarizeRegionsTask::SummarizeChunks, target_beg);
+  ParallelScavengeHeap::heap()->workers().run_task(&task);
+  *target_next = target_beg + total_words;
+}
+
+void PSParallelCompact::summarize_dense_prefix(HeapWord* beg, HeapWord* end)
+{
+  const size_t beg_region = _summary_data.addr_to_region_idx(beg);
+  const size_t end_region = _summary_data.addr_to_region_idx(end);
+  if (!should_summarize_in_parallel(beg_region, end_region)) {
+    _summary_data.summarize_dense_prefix(beg, end);
+    return;
+  }
+
+  PSSummarizeRegionsTask task(NULL, beg_region, end_region);
+  task.set_step(PSSummarizeRegionsTask::SummarizeDensePrefix, NULL);
+  ParallelScavengeHeap::heap()->workers().run_task(&task);
+}
+
 void PSParallelCompact::summarize_spaces_quick()
 {
   for (unsigned int i = 0; i < last_space_id; ++i) {
     const MutableSpace* space = _space_info[i].space();
     HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), NULL,
-                                          space->bottom(), space->end(), nta);
-    assert(result, "space must fit into itself");
+    summarize_fitting(_space_info[i].split_info(),
+                      space->bottom(), space->top(),
+                      space->bottom(), space->end(), nta);
     _space_info[i].set_dense_prefix(space->bottom());
   }
 }
@@ -1519,7 +1684,11 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
 
   const MutableSpace* space = _space_info[id].space();
   if (_space_info[id].new_top() != space->bottom()) {
-    HeapWord* dense_prefix_end = compute_dense_prefix(id, maximum_compaction);
+    HeapWord* dense_prefix_end;
+    {
+      GCTraceTime(Debug, gc, phases) tm("Compute Dense Prefix", &_gc_timer);
+      dense_prefix_end = compute_dense_prefix(id, maximum_compaction);
+    }
     _space_info[id].set_dense_prefix(dense_prefix_end);
 
 #ifndef PRODUCT
@@ -1535,6 +1704,8 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
     // every last byte will be reclaimed, then the existing summary data which
     // compacts everything can be left in place.
     if (!maximum_compaction && dense_prefix_end != space->bottom()) {
+      GCTraceTime(Debug, gc, phases) tm("Summarize Dense Prefix", &_gc_timer);
+
       // If dead space crosses the dense prefix boundary, it is (at least
       // partially) filled with a dummy object, marked live and added to the
       // summary data.  This simplifies the copy/update phase and must be done
@@ -1543,11 +1714,11 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
       fill_dense_prefix_end(id);
 
       // Compute the destination of each Region, and thus each object.
-      _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
-      _summary_data.summarize(_space_info[id].split_info(),
-                              dense_prefix_end, space->top(), NULL,
-                              dense_prefix_end, space->end(),
-                              _space_info[id].new_top_addr());
+      summarize_dense_prefix(space->bottom(), dense_prefix_end);
+      summarize_fitting(_space_info[id].split_info(),
+                        dense_prefix_end, space->top(),
+                        dense_prefix_end, space->end(),
+                        _space_info[id].new_top_addr());
     }
   }
 
@@ -1598,7 +1769,10 @@ void PSParallelCompact::summary_phase(ParCompactionManager* cm,
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
 
   // Quick summarization of each space into itself, to see how much is live.
-  summarize_spaces_quick();
+  {
+    GCTraceTime(Debug, gc, phases) tm("Summarize Spaces", &_gc_timer);
+    summarize_spaces_quick();
+  }
 
   log_develop_trace(gc, compaction)("summary phase:  after summarizing each space to self");
   NOT_PRODUCT(print_region_ranges());
@@ -1621,6 +1795,8 @@ void PSParallelCompact::summary_phase(ParCompactionManager* cm,
   // Old generations.
   summarize_space(old_space_id, maximum_compaction);
 
+  GCTraceTime(Debug, gc, phases) tm_young("Summarize Young Spaces", &_gc_timer);
+
   // Summarize the remaining spaces in the young gen.  The initial target space
   // is the old gen.  If a space does not fit entirely into the target, then the
   // remainder is compacted into the space itself and that space becomes the new
@@ -1638,12 +1814,10 @@ void PSParallelCompact::summary_phase(ParCompactionManager* cm,
                                   SpaceId(id), space->bottom(), space->top());)
     if (live > 0 && live <= available) {
       // All the live data will fit.
-      bool done = _summary_data.summarize(_space_info[id].split_info(),
-                                          space->bottom(), space->top(),
-                                          NULL,
-                                          *new_top_addr, dst_space_end,
-                                          new_top_addr);
-      assert(done, "space must fit into old gen");
+      summarize_fitting(_space_info[id].split_info(),
+                        space->bottom(), space->top(),
+                        *new_top_addr, dst_space_end,
+                        new_top_addr);
 
       // Reset the new_top value for the space.
       _space_info[id].set_new_top(space->bottom());
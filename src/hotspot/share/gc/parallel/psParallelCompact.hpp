@@ -431,6 +431,7 @@ public:
   // destination of region n is simply the start of region n.  Both arguments
   // beg and end must be region-aligned.
   void summarize_dense_prefix(HeapWord* beg, HeapWord* end);
+  void summarize_dense_prefix_region(size_t region);
 
   HeapWord* summarize_split_space(size_t src_region, SplitInfo& split_info,
                                   HeapWord* destination, HeapWord* target_end,
@@ -441,6 +442,13 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Set the destination_count of cur_region, whose live data (words) will be
+  // copied to dest_addr, and the source_region of the destination regions for
+  // which cur_region is the first source.  The destination of cur_region must
+  // already be set.
+  void summarize_region(SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr, size_t words);
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -1103,6 +1111,15 @@ class PSParallelCompact : AllStatic {
   // non-empty.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Summarize [source_beg, source_end) into the target space starting at
+  // target_beg, which must be large enough to hold all of its live data.
+  // Large ranges are summarized in parallel.
+  static void summarize_fitting(SplitInfo& split_info,
+                                HeapWord* source_beg, HeapWord* source_end,
+                                HeapWord* target_beg, HeapWord* target_end,
+                                HeapWord** target_next);
+  static void summarize_dense_prefix(HeapWord* beg, HeapWord* end);
+
   static void summarize_spaces_quick();
   static void summarize_space(SpaceId id, bool maximum_compaction);
   static void summary_phase(ParCompactionManager* cm, bool maximum_compaction);
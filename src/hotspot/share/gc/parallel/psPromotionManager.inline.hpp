@@ -125,6 +125,11 @@ inline void PSPromotionManager::push_contents(oop obj) {
     obj->oop_iterate_backwards(&pcc);
   }
 }
+
+inline void PSPromotionManager::push_contents_bounded(oop obj, HeapWord* left, HeapWord* right) {
+  PSPushContentsClosure pcc(this);
+  obj->oop_iterate(&pcc, MemRegion(left, right));
+}
 //
 // This method is pretty bulky. It would be nice to split it up
 // into smaller submethods, but we need to be careful not to hurt
@@ -294,6 +294,7 @@ class ScavengeRootsTask : public AbstractGangTask {
   uint _active_workers;
   bool _is_empty;
   TaskTerminator _terminator;
+  PSStripeClaimer _stripe_claimer;
 
 public:
   ScavengeRootsTask(PSOldGen* old_gen,
@@ -307,7 +308,14 @@ public:
       _gen_top(gen_top),
       _active_workers(active_workers),
       _is_empty(is_empty),
-      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()) {
+      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()),
+      _stripe_claimer(active_workers) {
+  }
+
+  void print_stripe_stats() const {
+    if (!_is_empty) {
+      _stripe_claimer.print_stats();
+    }
   }
 
   virtual void work(uint worker_id) {
@@ -331,8 +339,8 @@ public:
                                                _old_gen->object_space(),
                                                _gen_top,
                                                pm,
-                                               worker_id,
-                                               _active_workers);
+                                               &_stripe_claimer,
+                                               worker_id);
 
         // Do the real work
         pm->drain_stacks(false);
@@ -486,6 +494,7 @@ bool PSScavenge::invoke_no_policy() {
 
       ScavengeRootsTask task(old_gen, old_top, active_workers, old_gen->object_space()->is_empty());
       ParallelScavengeHeap::heap()->workers().run_task(&task);
+      task.print_stripe_stats();
     }
 
     scavenge_midpoint.update();
@@ -47,8 +47,24 @@ class STWGCTimer;
 //
 // Class unloading will only occur when a full gc is invoked.
 
+// An object whose mark word is overwritten by the forwarding pointer during
+// full GC, and the mark word to restore afterwards.
+class PreservedMark {
+private:
+  oop _obj;
+  markWord _mark;
+
+public:
+  void init(oop obj, markWord mark) {
+    _obj = obj;
+    _mark = mark;
+  }
+
+  void adjust_pointer();
+  void restore();
+};
+
 // declared at end
-class PreservedMark;
 class MarkAndPushClosure;
 class AdjustPointerClosure;
 
@@ -99,9 +115,9 @@ class MarkSweep : AllStatic {
   static Stack<oop, mtGC>                      _marking_stack;
   static Stack<ObjArrayTask, mtGC>             _objarray_stack;
 
-  // Space for storing/restoring mark word
-  static Stack<markWord, mtGC>                 _preserved_mark_stack;
-  static Stack<oop, mtGC>                      _preserved_oop_stack;
+  // Space for storing/restoring mark word. The marks are kept in the free
+  // part of to-space if possible, and the rest in the overflow stack.
+  static Stack<PreservedMark, mtGC>            _preserved_overflow_stack;
   static size_t                          _preserved_count;
   static size_t                          _preserved_count_max;
   static PreservedMark*                  _preserved_marks;
@@ -193,19 +209,4 @@ class AdjustPointerClosure: public BasicOopIterateClosure {
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS; }
 };
 
-class PreservedMark {
-private:
-  oop _obj;
-  markWord _mark;
-
-public:
-  void init(oop obj, markWord mark) {
-    _obj = obj;
-    _mark = mark;
-  }
-
-  void adjust_pointer();
-  void restore();
-};
-
 #endif // SHARE_GC_SERIAL_MARKSWEEP_HPP
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/concurrentGCThreadBudget.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+
+Monitor* ConcurrentGCThreadBudget::_monitor = NULL;
+uint ConcurrentGCThreadBudget::_budget = 0;
+volatile uint ConcurrentGCThreadBudget::_in_use = 0;
+volatile uint ConcurrentGCThreadBudget::_waiting[] = {};
+
+void ConcurrentGCThreadBudget::initialize() {
+  assert(_monitor == NULL, "Already initialized");
+  if (ConcGCThreadBudgetPercent == 0) {
+    return;
+  }
+  _budget = MAX2((uint)(os::active_processor_count() * ConcGCThreadBudgetPercent / 100), 1u);
+  _monitor = new Monitor(Mutex::leaf,
+                         "ConcurrentGCThreadBudget monitor",
+                         true,
+                         Monitor::_safepoint_check_never);
+  log_info(gc, init)("Concurrent GC Thread Budget: %u", _budget);
+}
+
+bool ConcurrentGCThreadBudget::has_waiting_above(Priority priority) {
+  for (uint p = High; p < (uint)priority; p++) {
+    if (Atomic::load(&_waiting[p]) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ConcurrentGCThreadBudget::acquire(Priority priority) {
+  assert(is_enabled(), "precondition");
+  MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+  Atomic::inc(&_waiting[priority]);
+  while (_in_use >= _budget || has_waiting_above(priority)) {
+    ml.wait();
+  }
+  Atomic::dec(&_waiting[priority]);
+  Atomic::inc(&_in_use);
+}
+
+void ConcurrentGCThreadBudget::release() {
+  assert(is_enabled(), "precondition");
+  MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+  assert(_in_use > 0, "Releasing unacquired slot");
+  Atomic::dec(&_in_use);
+  // Wake up all waiters so that the one with the highest priority gets the slot.
+  ml.notify_all();
+}
+
+bool ConcurrentGCThreadBudget::should_yield(Priority priority) {
+  return is_enabled() &&
+         Atomic::load(&_in_use) >= _budget &&
+         has_waiting_above(priority);
+}
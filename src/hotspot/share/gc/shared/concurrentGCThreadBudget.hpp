@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_CONCURRENTGCTHREADBUDGET_HPP
+#define SHARE_GC_SHARED_CONCURRENTGCTHREADBUDGET_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class Monitor;
+
+// Limits the number of concurrent GC background threads that do work at the
+// same time to a CPU budget derived from os::active_processor_count() and
+// ConcGCThreadBudgetPercent. Threads acquire a slot before doing a unit of
+// work and release it when going idle. Waiting threads are granted slots in
+// priority order, and threads with a low priority are asked to give up their
+// slot when threads with a higher priority are waiting.
+//
+// A thread must not wait for a slot while it is joined to the suspendible
+// thread set or holding locks, as the slot holders may need a safepoint to
+// make progress.
+class ConcurrentGCThreadBudget : public AllStatic {
+public:
+  enum Priority {
+    High,     // Work that mutators otherwise do themselves, e.g. refinement.
+    Normal,   // Periodic service work.
+    Low,      // Optional work, e.g. string deduplication.
+    NumPriorities
+  };
+
+private:
+  static Monitor* _monitor;
+  static uint _budget;
+  static volatile uint _in_use;
+  static volatile uint _waiting[NumPriorities];
+
+  static bool has_waiting_above(Priority priority);
+
+public:
+  // Enables the budget if ConcGCThreadBudgetPercent is non-zero.
+  static void initialize();
+  static bool is_enabled() { return _monitor != NULL; }
+  static uint budget() { return _budget; }
+
+  static void acquire(Priority priority);
+  static void release();
+
+  // Returns true if the caller holds a slot another thread with a
+  // higher priority is waiting for.
+  static bool should_yield(Priority priority);
+};
+
+// Holds a slot of the budget, if enabled, for the duration of a scope.
+class ConcurrentGCThreadBudgetSlot : public StackObj {
+  bool _acquired;
+
+public:
+  ConcurrentGCThreadBudgetSlot(ConcurrentGCThreadBudget::Priority priority) :
+      _acquired(ConcurrentGCThreadBudget::is_enabled()) {
+    if (_acquired) {
+      ConcurrentGCThreadBudget::acquire(priority);
+    }
+  }
+  ~ConcurrentGCThreadBudgetSlot() {
+    if (_acquired) {
+      ConcurrentGCThreadBudget::release();
+    }
+  }
+};
+
+#endif // SHARE_GC_SHARED_CONCURRENTGCTHREADBUDGET_HPP
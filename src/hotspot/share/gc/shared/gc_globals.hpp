@@ -150,6 +150,12 @@
           "Number of threads concurrent gc will use")                       \
           constraint(ConcGCThreadsConstraintFunc,AfterErgo)                 \
                                                                             \
+  product(uintx, ConcGCThreadBudgetPercent, 0, EXPERIMENTAL,                \
+          "Percentage of the active processors that background threads "    \
+          "for concurrent refinement, string deduplication and service "    \
+          "tasks may keep busy at the same time. Zero means no limit.")     \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, AlwaysTenure, false,                                        \
           "Always tenure objects in eden (ParallelGC only)")                \
                                                                             \
@@ -40,6 +40,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/events.hpp"
 
@@ -166,6 +167,8 @@ oop Generation::promote(oop obj, size_t obj_size) {
 
   HeapWord* result = allocate(obj_size, false);
   if (result != NULL) {
+    // Prefetch beyond result, as is done when copying to survivor space.
+    Prefetch::write(result, PrefetchCopyIntervalInBytes);
     Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(obj), result, obj_size);
     return cast_to_oop(result);
   } else {
@@ -38,6 +38,7 @@
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/nonJavaThread.hpp"
 
@@ -541,24 +542,40 @@ private:
   ReferencePolicy* _policy;
 };
 
+// Phase 2 only calls complete_gc once per worker at the end, so instead of
+// every worker processing the lists at its own index, workers claim lists of
+// each reference type dynamically. A worker that is done with its lists of one
+// type helps with the remaining lists of that type before moving on, so slow
+// lists (e.g. with expensive is_alive checks) do not serialize the phase.
 class RefProcPhase2Task: public AbstractRefProcTaskExecutor::ProcessTask {
-  void run_phase2(uint worker_id,
-                  DiscoveredList list[],
+  volatile uint _next_list[REF_FINAL + 1]; // Indexed by reference type.
+
+  void run_phase2(DiscoveredList list[],
                   BoolObjectClosure& is_alive,
                   OopClosure& keep_alive,
                   bool do_enqueue_and_clear,
                   ReferenceType ref_type) {
-    size_t const removed = _ref_processor.process_soft_weak_final_refs_work(list[worker_id],
-                                                                            &is_alive,
-                                                                            &keep_alive,
-                                                                            do_enqueue_and_clear);
+    uint const num_lists = _ref_processor.num_queues();
+    size_t removed = 0;
+    for (uint i = Atomic::fetch_and_add(&_next_list[ref_type], 1u);
+         i < num_lists;
+         i = Atomic::fetch_and_add(&_next_list[ref_type], 1u)) {
+      removed += _ref_processor.process_soft_weak_final_refs_work(list[i],
+                                                                  &is_alive,
+                                                                  &keep_alive,
+                                                                  do_enqueue_and_clear);
+    }
     _phase_times->add_ref_cleared(ref_type, removed);
   }
 
 public:
   RefProcPhase2Task(ReferenceProcessor& ref_processor,
                     ReferenceProcessorPhaseTimes* phase_times)
-    : ProcessTask(ref_processor, false /* marks_oops_alive */, phase_times) { }
+    : ProcessTask(ref_processor, false /* marks_oops_alive */, phase_times) {
+    for (uint i = 0; i < ARRAY_SIZE(_next_list); i++) {
+      _next_list[i] = 0;
+    }
+  }
 
   virtual void work(uint worker_id,
                     BoolObjectClosure& is_alive,
@@ -567,15 +584,15 @@ public:
     RefProcWorkerTimeTracker t(_phase_times->phase2_worker_time_sec(), worker_id);
     {
       RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::SoftRefSubPhase2, _phase_times, worker_id);
-      run_phase2(worker_id, _ref_processor._discoveredSoftRefs, is_alive, keep_alive, true /* do_enqueue_and_clear */, REF_SOFT);
+      run_phase2(_ref_processor._discoveredSoftRefs, is_alive, keep_alive, true /* do_enqueue_and_clear */, REF_SOFT);
     }
     {
       RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::WeakRefSubPhase2, _phase_times, worker_id);
-      run_phase2(worker_id, _ref_processor._discoveredWeakRefs, is_alive, keep_alive, true /* do_enqueue_and_clear */, REF_WEAK);
+      run_phase2(_ref_processor._discoveredWeakRefs, is_alive, keep_alive, true /* do_enqueue_and_clear */, REF_WEAK);
     }
     {
       RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::FinalRefSubPhase2, _phase_times, worker_id);
-      run_phase2(worker_id, _ref_processor._discoveredFinalRefs, is_alive, keep_alive, false /* do_enqueue_and_clear */, REF_FINAL);
+      run_phase2(_ref_processor._discoveredFinalRefs, is_alive, keep_alive, false /* do_enqueue_and_clear */, REF_FINAL);
     }
     // Close the reachable set; needed for collectors which keep_alive_closure do
     // not immediately complete their work.
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/stringdedup/stringDedupStat.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 
 StringDedupStat::StringDedupStat() :
@@ -91,6 +92,22 @@ void StringDedupStat::print_end(const StringDedupStat* last_stat, const StringDe
     STRDEDUP_TIME_PARAM_MS(last_stat->_exec_elapsed));
 }
 
+void StringDedupStat::send_event() const {
+  EventStringDeduplication e;
+  if (e.should_commit()) {
+    e.set_inspected(_inspected);
+    e.set_skipped(_skipped);
+    e.set_known(_known);
+    e.set_candidates(_new);
+    e.set_candidatesSize(_new_bytes);
+    e.set_deduplicated(_deduped);
+    e.set_deduplicatedSize(_deduped_bytes);
+    e.set_blocked(_block);
+    e.set_executionTime((jlong)(_exec_elapsed * MILLIUNITS));
+    e.commit();
+  }
+}
+
 void StringDedupStat::reset() {
   _inspected = 0;
   _skipped = 0;
@@ -83,6 +83,7 @@ void StringDedupThread::print_start(const StringDedupStat* last_stat) {
 }
 
 void StringDedupThread::print_end(const StringDedupStat* last_stat, const StringDedupStat* total_stat) {
+  last_stat->send_event();
   StringDedupStat::print_end(last_stat, total_stat);
   if (log_is_enabled(Debug, gc, stringdedup)) {
     last_stat->print_statistics(false);
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPTHREAD_INLINE_HPP
 #define SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPTHREAD_INLINE_HPP
 
+#include "gc/shared/concurrentGCThreadBudget.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/stringdedup/stringDedupQueue.inline.hpp"
 #include "gc/shared/stringdedup/stringDedupThread.hpp"
@@ -52,6 +53,9 @@ void StringDedupThreadImpl<S>::do_deduplication() {
     }
 
     {
+      // Wait for our share of the concurrent GC thread budget before
+      // joining the suspendible thread set.
+      ConcurrentGCThreadBudgetSlot budget_slot(ConcurrentGCThreadBudget::Low);
       // Include thread in safepoints
       SuspendibleThreadSetJoiner sts_join;
 
@@ -73,6 +77,13 @@ void StringDedupThreadImpl<S>::do_deduplication() {
           sts_join.yield();
           stat.mark_unblock();
         }
+
+        // Give the budget slot to more important concurrent work. The
+        // queue is not empty so processing continues once a slot is
+        // available again.
+        if (ConcurrentGCThreadBudget::should_yield(ConcurrentGCThreadBudget::Low)) {
+          break;
+        }
       }
 
       stat.mark_done();
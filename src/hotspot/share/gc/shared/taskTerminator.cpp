@@ -73,12 +73,17 @@ TaskTerminator::TaskTerminator(uint n_threads, TaskQueueSetSuper* queue_set) :
   _queue_set(queue_set),
   _offered_termination(0),
   _blocker(Mutex::leaf, "TaskTerminator", false, Monitor::_safepoint_check_never),
-  _spin_master(NULL) { }
+  _spin_master(NULL),
+  _num_offers(0),
+  _num_failed_offers(0),
+  _num_waits(0),
+  _offer_time() { }
 
 TaskTerminator::~TaskTerminator() {
   if (_offered_termination != 0) {
     assert(_offered_termination == _n_threads, "Must be terminated or aborted");
     assert_queue_set_empty();
+    log_and_reset_stats();
   }
 
   assert(_spin_master == NULL, "Should have been reset");
@@ -96,9 +101,37 @@ void TaskTerminator::reset_for_reuse() {
            "Only %u of %u threads offered termination", _offered_termination, _n_threads);
     assert(_spin_master == NULL, "Leftover spin master " PTR_FORMAT, p2i(_spin_master));
     _offered_termination = 0;
+    log_and_reset_stats();
   }
 }
 
+void TaskTerminator::log_and_reset_stats() {
+  log_debug(gc, task, stats)("Termination: threads %u offers %u failed offers %u waits %u time %.3fms",
+                             _n_threads, _num_offers, _num_failed_offers, _num_waits,
+                             _offer_time.seconds() * MILLIUNITS);
+  _num_offers = 0;
+  _num_failed_offers = 0;
+  _num_waits = 0;
+  _offer_time = Tickspan();
+}
+
+// Records an offer and the time spent in it. Must be declared after the
+// MonitorLocker so that it is destroyed while _blocker is still held.
+class TaskTerminator::OfferTimeTracker : public StackObj {
+  TaskTerminator* _terminator;
+  Ticks _start;
+
+public:
+  OfferTimeTracker(TaskTerminator* terminator, Ticks start) :
+    _terminator(terminator), _start(start) {
+    _terminator->_num_offers++;
+  }
+
+  ~OfferTimeTracker() {
+    _terminator->_offer_time += Ticks::now() - _start;
+  }
+};
+
 void TaskTerminator::reset_for_reuse(uint n_threads) {
   reset_for_reuse();
   _n_threads = n_threads;
@@ -143,7 +176,9 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
 
   Thread* the_thread = Thread::current();
 
+  Ticks start = Ticks::now();
   MonitorLocker x(&_blocker, Mutex::_no_safepoint_check_flag);
+  OfferTimeTracker ott(this, start);
   _offered_termination++;
 
   if (_offered_termination == _n_threads) {
@@ -176,12 +211,14 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
         } else if (should_exit_termination) {
           prepare_for_return(the_thread, tasks);
           _offered_termination--;
+          _num_failed_offers++;
           return false;
         }
       }
       // Give up spin master before sleeping.
       _spin_master = NULL;
     }
+    _num_waits++;
     bool timed_out = x.wait(WorkStealingSleepMillis);
 
     // Immediately check exit conditions after re-acquiring the lock.
@@ -193,12 +230,14 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
       // We were woken up. Don't bother waking up more tasks.
       prepare_for_return(the_thread, 0);
       _offered_termination--;
+      _num_failed_offers++;
       return false;
     } else {
       size_t tasks = tasks_in_queue_set();
       if (exit_termination(tasks, terminator)) {
         prepare_for_return(the_thread, tasks);
         _offered_termination--;
+        _num_failed_offers++;
         return false;
       }
     }
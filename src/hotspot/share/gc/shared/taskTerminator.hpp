@@ -28,6 +28,7 @@
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "runtime/mutex.hpp"
+#include "utilities/ticks.hpp"
 
 class TaskQueueSetSuper;
 class TerminatorTerminator;
@@ -79,6 +80,17 @@ class TaskTerminator : public CHeapObj<mtGC> {
   Monitor _blocker;
   Thread* _spin_master;
 
+  // Statistics for the current round of use, protected by _blocker.
+  uint _num_offers;         // Calls to offer_termination().
+  uint _num_failed_offers;  // Offers that returned because of new work.
+  uint _num_waits;          // Waits on _blocker instead of spinning.
+  Tickspan _offer_time;     // Time spent in offer_termination() by all threads.
+
+  class OfferTimeTracker;
+
+  // Logs and clears the statistics of the current round of use.
+  void log_and_reset_stats();
+
   void assert_queue_set_empty() const NOT_DEBUG_RETURN;
 
   // Prepare for return from offer_termination. Gives up the spin master token
@@ -25,8 +25,11 @@
 #include "precompiled.hpp"
 #include "compiler/compilerDefinitions.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -85,28 +88,31 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
-
-    if (update_allocation_history) {
-      // Average the fraction of eden allocated in a tlab by this
-      // thread for use in the next resize operation.
-      // _gc_waste is not subtracted because it's included in
-      // "used".
-      // The result can be larger than 1.0 due to direct to old allocations.
-      // These allocations should ideally not be counted but since it is not possible
-      // to filter them out here we just cap the fraction to be at most 1.0.
-      // Keep alloc_frac as float and not double to avoid the double to float conversion
-      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
-      _allocation_fraction.sample(alloc_frac);
-    }
+  // Update allocation history if a reasonable amount of eden was allocated.
+  // Threads that did not refill since the last GC are sampled too, so that
+  // the desired size of a thread that became idle decays instead of staying
+  // at the size it had while it was allocating.
+  bool update_allocation_history = used > 0.5 * capacity;
+  if (update_allocation_history) {
+    // Average the fraction of eden allocated in a tlab by this
+    // thread for use in the next resize operation.
+    // _gc_waste is not subtracted because it's included in
+    // "used".
+    // The result can be larger than 1.0 due to direct to old allocations.
+    // These allocations should ideally not be counted but since it is not possible
+    // to filter them out here we just cap the fraction to be at most 1.0.
+    // Keep alloc_frac as float and not double to avoid the double to float conversion
+    float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+    _allocation_fraction.sample(alloc_frac);
+  }
 
+  if (_number_of_refills > 0) {
     stats->update_fast_allocations(_number_of_refills,
                                    _allocated_size,
                                    _gc_waste,
                                    _fast_refill_waste,
                                    _slow_refill_waste);
+    send_statistics_event();
   } else {
     assert(_number_of_refills == 0 && _fast_refill_waste == 0 &&
            _slow_refill_waste == 0 && _gc_waste          == 0,
@@ -315,6 +321,22 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _fast_refill_waste * HeapWordSize);
 }
 
+void ThreadLocalAllocBuffer::send_statistics_event() {
+  EventThreadTLABStatistics event;
+  if (event.should_commit()) {
+    event.set_gcId(GCId::current_or_undefined());
+    event.set_thread(JFR_THREAD_ID(thread()));
+    event.set_refills(_number_of_refills);
+    event.set_allocated(_allocated_size * HeapWordSize);
+    event.set_gcWaste(_gc_waste * HeapWordSize);
+    event.set_slowRefillWaste(_slow_refill_waste * HeapWordSize);
+    event.set_fastRefillWaste(_fast_refill_waste * HeapWordSize);
+    event.set_slowAllocations(_slow_allocations);
+    event.set_desiredSize(_desired_size * HeapWordSize);
+    event.commit();
+  }
+}
+
 void ThreadLocalAllocBuffer::set_sample_end(bool reset_byte_accumulation) {
   size_t heap_words_remaining = pointer_delta(_end, _top);
   size_t bytes_until_sample = thread()->heap_sampler().bytes_until_sample();
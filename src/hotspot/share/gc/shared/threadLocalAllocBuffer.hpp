@@ -100,6 +100,7 @@ private:
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
   void print_stats(const char* tag);
+  void send_statistics_event();
 
   Thread* thread();
 
@@ -91,6 +91,9 @@ class WeakProcessor::Task {
 
   void initialize();
 
+  template<typename IsAlive, typename KeepAlive>
+  void work_storage(OopStorageSet::WeakId id, uint worker_id, IsAlive* is_alive, KeepAlive* keep_alive);
+
 public:
   Task(uint nworkers);          // No time tracking.
   Task(WeakProcessorTimes* times, uint nworkers);
@@ -82,16 +82,37 @@ void WeakProcessor::Task::work(uint worker_id,
          "worker_id (%u) exceeds task's configured workers (%u)",
          worker_id, _nworkers);
 
-  for (auto id : EnumRange<OopStorageSet::WeakId>()) {
-    CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
-    WeakProcessorParTimeTracker pt(_times, id, worker_id);
-    StorageState* cur_state = _storage_states.par_state(id);
-    assert(cur_state->storage() == OopStorageSet::storage(id), "invariant");
-    cur_state->oops_do(&cl);
-    cur_state->increment_num_dead(cl.dead());
-    if (_times != NULL) {
-      _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total());
-    }
+  // Every worker processes all storages, claiming blocks dynamically, so the
+  // blocks of a large storage are shared by all workers that are done with
+  // the smaller ones. Workers start at different storages so that they do
+  // not all contend on claiming the blocks of the first one.
+  typedef EnumRange<OopStorageSet::WeakId> WeakIdRange;
+  WeakIdRange all_ids;
+  WeakIdRange::Iterator start = all_ids.begin();
+  for (uint i = worker_id % all_ids.size(); i > 0; i--) {
+    ++start;
+  }
+  for (auto id : WeakIdRange(*start)) {
+    work_storage(id, worker_id, is_alive, keep_alive);
+  }
+  for (auto id : WeakIdRange(all_ids.first(), *start)) {
+    work_storage(id, worker_id, is_alive, keep_alive);
+  }
+}
+
+template<typename IsAlive, typename KeepAlive>
+void WeakProcessor::Task::work_storage(OopStorageSet::WeakId id,
+                                       uint worker_id,
+                                       IsAlive* is_alive,
+                                       KeepAlive* keep_alive) {
+  CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
+  WeakProcessorParTimeTracker pt(_times, id, worker_id);
+  StorageState* cur_state = _storage_states.par_state(id);
+  assert(cur_state->storage() == OopStorageSet::storage(id), "invariant");
+  cur_state->oops_do(&cl);
+  cur_state->increment_num_dead(cl.dead());
+  if (_times != NULL) {
+    _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total());
   }
 }
 
@@ -89,6 +89,9 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
   size_t immediate_garbage = 0;
   size_t immediate_regions = 0;
 
+  // Garbage in regions that were first allocated into after the previous mark
+  size_t young_garbage = 0;
+
   size_t free = 0;
   size_t free_regions = 0;
 
@@ -99,6 +102,9 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
 
     size_t garbage = region->garbage();
     total_garbage += garbage;
+    if (region->age() <= 1) {
+      young_garbage += garbage;
+    }
 
     if (region->is_empty()) {
       free_regions++;
@@ -172,6 +178,12 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
                      byte_size_in_proper_unit(collection_set->garbage()),
                      proper_unit_for_byte_size(collection_set->garbage()),
                      cset_percent);
+
+  size_t young_percent = (total_garbage == 0) ? 0 : (young_garbage * 100 / total_garbage);
+  log_debug(gc, ergo)("Young Garbage: " SIZE_FORMAT "%s (" SIZE_FORMAT "%%), in regions allocated since last mark",
+                      byte_size_in_proper_unit(young_garbage),
+                      proper_unit_for_byte_size(young_garbage),
+                      young_percent);
 }
 
 void ShenandoahHeuristics::record_cycle_start() {
@@ -30,7 +30,9 @@
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/safepoint.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
@@ -402,26 +404,56 @@ void ShenandoahFreeSet::clear_internal() {
   _used = 0;
 }
 
-void ShenandoahFreeSet::rebuild() {
-  shenandoah_assert_heaplocked();
-  clear();
+size_t ShenandoahFreeSet::par_add_mutator_free(ShenandoahHeapRegion *r) {
+  if (r->is_alloc_allowed() || r->is_trash()) {
+    assert(!r->is_cset(), "Shouldn't be adding those to the free set");
 
-  for (size_t idx = 0; idx < _heap->num_regions(); idx++) {
-    ShenandoahHeapRegion* region = _heap->get_region(idx);
-    if (region->is_alloc_allowed() || region->is_trash()) {
-      assert(!region->is_cset(), "Shouldn't be adding those to the free set");
+    // Do not add regions that would surely fail allocation
+    if (has_no_alloc_capacity(r)) return 0;
 
-      // Do not add regions that would surely fail allocation
-      if (has_no_alloc_capacity(region)) continue;
+    assert(!is_mutator_free(r->index()), "We are about to add it, it shouldn't be there already");
+    _mutator_free_bitmap.par_set_bit(r->index());
+    return alloc_capacity(r);
+  }
+  return 0;
+}
 
-      _capacity += alloc_capacity(region);
-      assert(_used <= _capacity, "must not use more than we have");
+class ShenandoahRebuildFreeSetClosure : public ShenandoahHeapRegionClosure {
+private:
+  ShenandoahFreeSet* const _free_set;
+  volatile size_t _capacity;
 
-      assert(!is_mutator_free(idx), "We are about to add it, it shouldn't be there already");
-      _mutator_free_bitmap.set_bit(idx);
+public:
+  ShenandoahRebuildFreeSetClosure(ShenandoahFreeSet* free_set) :
+    _free_set(free_set), _capacity(0) {}
+
+  void heap_region_do(ShenandoahHeapRegion* r) {
+    size_t ac = _free_set->par_add_mutator_free(r);
+    if (ac > 0) {
+      Atomic::add(&_capacity, ac, memory_order_relaxed);
     }
   }
 
+  bool is_thread_safe() { return true; }
+
+  size_t capacity() const { return Atomic::load(&_capacity); }
+};
+
+void ShenandoahFreeSet::rebuild() {
+  shenandoah_assert_heaplocked();
+  clear();
+
+  // Scan regions in parallel when workers are available. Workers do not take
+  // the heap lock, so holding it while they run is fine.
+  ShenandoahRebuildFreeSetClosure cl(this);
+  if (SafepointSynchronize::is_at_safepoint()) {
+    _heap->parallel_heap_region_iterate(&cl);
+  } else {
+    _heap->heap_region_iterate(&cl);
+  }
+  _capacity = cl.capacity();
+  assert(_used <= _capacity, "must not use more than we have");
+
   // Evac reserve: reserve trailing space for evacuations
   size_t to_reserve = _heap->max_capacity() / 100 * ShenandoahEvacReserve;
   size_t reserved = 0;
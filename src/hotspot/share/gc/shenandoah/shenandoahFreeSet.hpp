@@ -29,6 +29,8 @@
 #include "gc/shenandoah/shenandoahHeap.hpp"
 
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahRebuildFreeSetClosure;
+
 private:
   ShenandoahHeap* const _heap;
   CHeapBitMap _mutator_free_bitmap;
@@ -70,6 +72,10 @@ private:
   size_t alloc_capacity(ShenandoahHeapRegion *r);
   bool has_no_alloc_capacity(ShenandoahHeapRegion *r);
 
+  // Adds the region to the mutator free set if it can be allocated from,
+  // and returns its allocation capacity. Safe to call in parallel.
+  size_t par_add_mutator_free(ShenandoahHeapRegion *r);
+
 public:
   ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions);
 
@@ -32,6 +32,7 @@
 #include "gc/shenandoah/shenandoahHeap.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPadding.hpp"
+#include "oops/markWord.hpp"
 #include "utilities/sizes.hpp"
 
 class VMStructs;
@@ -210,6 +211,10 @@ public:
   void record_unpin();
   size_t pin_count() const;
 
+  uint age() const           { return _age; }
+  void increment_age()       { if (_age < markWord::max_age) _age++; }
+  void reset_age()           { _age = 0; }
+
 private:
   static size_t RegionCount;
   static size_t RegionSizeBytes;
@@ -246,6 +251,9 @@ private:
 
   HeapWord* volatile _update_watermark;
 
+  // Number of completed marks the region has been active through
+  uint _age;
+
 public:
   ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed);
 
@@ -28,6 +28,8 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadSMR.hpp"
@@ -182,6 +184,8 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_epoch_credit, initial);
+  Atomic::store(&_epoch_allocators, (size_t)0);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -222,11 +226,29 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
+bool ShenandoahPacer::is_over_share(JavaThread* thread, size_t words) {
+  // Account the claim to the thread, in tax units like the budget
+  size_t tax = MAX2<size_t>(1, words * Atomic::load(&_tax_rate));
+  if (ShenandoahThreadLocalData::add_paced_claim(thread, Atomic::load(&_epoch), tax)) {
+    Atomic::inc(&_epoch_allocators, memory_order_relaxed);
+  }
+
+  // The budget is depleted, so the allocating threads together claimed more
+  // than the credit provided in this phase. Then at least one of them claimed
+  // more than its even share of the credit, and only those threads stall.
+  size_t allocators = MAX2<size_t>(1, Atomic::load(&_epoch_allocators));
+  size_t share = Atomic::load(&_epoch_credit) / allocators;
+  return ShenandoahThreadLocalData::paced_claimed(thread) > share;
+}
+
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* const thread = JavaThread::current();
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc(words, false);
+  bool over_share = is_over_share(thread, words);
   if (claimed) {
     return;
   }
@@ -241,10 +263,17 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Threads that are attaching should not block at all: they are not
   // fully initialized yet. Blocking them would be awkward.
   // This is probably the path that allocates the thread oop itself.
-  if (JavaThread::current()->is_attaching_via_jni()) {
+  if (thread->is_attaching_via_jni()) {
+    return;
+  }
+
+  // Threads that claimed no more than their share of the credit in this
+  // phase allocate at a rate the GC keeps up with, let them continue.
+  if (!over_share) {
     return;
   }
 
+  EventShenandoahPacingStall event;
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
@@ -264,7 +293,8 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     Breaking out and allocating anyway, which may mean we outpace GC,
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
-      ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      ShenandoahThreadLocalData::add_paced_time(thread, end - start);
+      event.commit(words * HeapWordSize);
       break;
     }
   }
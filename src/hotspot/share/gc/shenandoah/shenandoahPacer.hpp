@@ -39,6 +39,9 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * When credit is not available, only the threads that claimed more than their share
+ * of the credit provided in the current phase stall. Threads allocating slower than
+ * the GC can keep up with are not stalled for the allocation spikes of others.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -62,6 +65,11 @@ private:
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Credit provided and number of allocating threads in the current phase
+  volatile size_t _epoch_credit;
+  volatile size_t _epoch_allocators;
+  shenandoah_padding(4);
+
 public:
   ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -71,7 +79,9 @@ public:
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {}
+          _progress(PACING_PROGRESS_UNINIT),
+          _epoch_credit(0),
+          _epoch_allocators(0) {}
 
   void setup_for_idle();
   void setup_for_mark();
@@ -106,6 +116,8 @@ private:
 
   size_t update_and_get_progress_history();
 
+  bool is_over_share(JavaThread* thread, size_t words);
+
   void wait(size_t time_ms);
 };
 
@@ -60,6 +60,7 @@ inline void ShenandoahPacer::add_budget(size_t words) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   intptr_t inc = (intptr_t) words;
   intptr_t new_budget = Atomic::add(&_budget, inc, memory_order_relaxed);
+  Atomic::add(&_epoch_credit, words, memory_order_relaxed);
 
   // Was the budget replenished beyond zero? Then all pacing claims
   // are satisfied, notify the waiters. Avoid taking any locks here,
@@ -157,6 +157,12 @@ private:
   void cld_do_impl(CldDo f, CLDClosure* clds, uint worker_id);
 };
 
+// In a concurrent cycle, VM roots (OopStorage) and CLD roots are only processed
+// concurrently: for marking by ShenandoahConcurrentRootScanner, and for
+// evacuation and update-refs by ShenandoahConcurrentRootsEvacUpdateTask. Thread
+// roots are updated concurrently using handshakes. Of the scanners below that
+// process these roots at a safepoint, the GC ones are only used by Degenerated
+// and Full GC; ShenandoahHeapIterationRootScanner serves heap iteration.
 class ShenandoahRootProcessor : public StackObj {
 private:
   ShenandoahHeap* const               _heap;
@@ -50,6 +50,8 @@ private:
   uint  _worker_id;
   int  _disarmed_value;
   double _paced_time;
+  intptr_t _paced_epoch;
+  size_t _paced_claimed;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -60,7 +62,9 @@ private:
     _gclab_size(0),
     _worker_id(INVALID_WORKER_ID),
     _disarmed_value(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _paced_epoch(0),
+    _paced_claimed(0) {
 
     // At least on x86_64, nmethod entry barrier encodes _disarmed_value offset
     // in instruction as disp8 immed
@@ -144,6 +148,22 @@ public:
     data(thread)->_paced_time = 0;
   }
 
+  // Returns true if this is the first claim by the thread in the given pacer epoch
+  static bool add_paced_claim(Thread* thread, intptr_t epoch, size_t claimed) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    if (d->_paced_epoch != epoch) {
+      d->_paced_epoch = epoch;
+      d->_paced_claimed = claimed;
+      return true;
+    }
+    d->_paced_claimed += claimed;
+    return false;
+  }
+
+  static size_t paced_claimed(Thread* thread) {
+    return data(thread)->_paced_claimed;
+  }
+
   static void set_disarmed_value(Thread* thread, int value) {
     data(thread)->_disarmed_value = value;
   }
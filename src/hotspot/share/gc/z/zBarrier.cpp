@@ -26,11 +26,14 @@
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zOop.inline.hpp"
+#include "gc/z/zStat.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "utilities/debug.hpp"
 
+static const ZStatCounter ZCounterLoadBarrierSlowPath("Barrier", "Load Slow Path", ZStatUnitOpsPerSecond);
+
 template <bool finalizable>
 bool ZBarrier::should_mark_through(uintptr_t addr) {
   // Finalizable marked oops can still exists on the heap after marking
@@ -126,6 +129,7 @@ uintptr_t ZBarrier::relocate_or_remap(uintptr_t addr) {
 // Load barrier
 //
 uintptr_t ZBarrier::load_barrier_on_oop_slow_path(uintptr_t addr) {
+  ZStatInc(ZCounterLoadBarrierSlowPath);
   return relocate_or_mark(addr);
 }
 
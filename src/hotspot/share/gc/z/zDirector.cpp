@@ -23,7 +23,6 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/gc_globals.hpp"
-#include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zDirector.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeuristics.hpp"
@@ -32,7 +31,8 @@
 
 const double ZDirector::one_in_1000 = 3.290527;
 
-ZDirector::ZDirector() :
+ZDirector::ZDirector(ZDriver* driver) :
+    _driver(driver),
     _relocation_headroom(ZHeuristics::relocation_headroom()),
     _metronome(ZStatAllocRate::sample_hz) {
   set_name("ZDirector");
@@ -86,10 +86,10 @@ bool ZDirector::rule_warmup() const {
   return used >= used_threshold;
 }
 
-bool ZDirector::rule_allocation_rate() const {
+ZDriverRequest ZDirector::rule_allocation_rate() const {
   if (!ZStatCycle::is_normalized_duration_trustable()) {
     // Rule disabled
-    return false;
+    return GCCause::_no_gc;
   }
 
   // Perform GC if the estimated max allocation rate indicates that we
@@ -128,7 +128,24 @@ bool ZDirector::rule_allocation_rate() const {
   log_debug(gc, director)("Rule: Allocation Rate, MaxAllocRate: %.3fMB/s, Free: " SIZE_FORMAT "MB, MaxDurationOfGC: %.3fs, TimeUntilGC: %.3fs",
                           max_alloc_rate / M, free / M, max_duration_of_gc, time_until_gc);
 
-  return time_until_gc <= 0;
+  if (time_until_gc > 0) {
+    return GCCause::_no_gc;
+  }
+
+  // The normalized duration of GC is based on the non-boosted number of
+  // worker threads. The rule above fires once the time until OOM drops
+  // below the pessimistic duration of GC. If it has even dropped below
+  // the average duration of GC, an allocation spike has outrun us and
+  // a cycle with the non-boosted number of worker threads is expected
+  // to end in allocation stalls, so run this cycle with boosted worker
+  // threads instead of waiting for the stalls to happen.
+  const bool boost = time_until_oom < duration_of_gc.davg();
+  if (boost) {
+    log_debug(gc, director)("Rule: Allocation Rate, TimeUntilOOM: %.3fs, AvgDurationOfGC: %.3fs, Boost",
+                            time_until_oom, duration_of_gc.davg());
+  }
+
+  return ZDriverRequest(GCCause::_z_allocation_rate, boost);
 }
 
 bool ZDirector::rule_proactive() const {
@@ -194,7 +211,7 @@ bool ZDirector::rule_high_usage() const {
   return free_percent <= 5.0;
 }
 
-GCCause::Cause ZDirector::make_gc_decision() const {
+ZDriverRequest ZDirector::make_gc_decision() const {
   // Rule 0: Timer
   if (rule_timer()) {
     return GCCause::_z_timer;
@@ -206,8 +223,9 @@ GCCause::Cause ZDirector::make_gc_decision() const {
   }
 
   // Rule 2: Allocation rate
-  if (rule_allocation_rate()) {
-    return GCCause::_z_allocation_rate;
+  const ZDriverRequest request = rule_allocation_rate();
+  if (request.cause() != GCCause::_no_gc) {
+    return request;
   }
 
   // Rule 3: Proactive
@@ -228,9 +246,9 @@ void ZDirector::run_service() {
   // Main loop
   while (_metronome.wait_for_tick()) {
     sample_allocation_rate();
-    const GCCause::Cause cause = make_gc_decision();
-    if (cause != GCCause::_no_gc) {
-      ZCollectedHeap::heap()->collect(cause);
+    const ZDriverRequest request = make_gc_decision();
+    if (request.cause() != GCCause::_no_gc) {
+      _driver->collect(request);
     }
   }
 }
@@ -26,30 +26,32 @@
 
 #include "gc/shared/concurrentGCThread.hpp"
 #include "gc/shared/gcCause.hpp"
+#include "gc/z/zDriver.hpp"
 #include "gc/z/zMetronome.hpp"
 
 class ZDirector : public ConcurrentGCThread {
 private:
   static const double one_in_1000;
 
-  const size_t _relocation_headroom;
-  ZMetronome   _metronome;
+  ZDriver* const _driver;
+  const size_t   _relocation_headroom;
+  ZMetronome     _metronome;
 
   void sample_allocation_rate() const;
 
   bool rule_timer() const;
   bool rule_warmup() const;
-  bool rule_allocation_rate() const;
+  ZDriverRequest rule_allocation_rate() const;
   bool rule_proactive() const;
   bool rule_high_usage() const;
-  GCCause::Cause make_gc_decision() const;
+  ZDriverRequest make_gc_decision() const;
 
 protected:
   virtual void run_service();
   virtual void stop_service();
 
 public:
-  ZDirector();
+  ZDirector(ZDriver* driver);
 };
 
 #endif // SHARE_GC_Z_ZDIRECTOR_HPP
@@ -137,7 +137,7 @@ static bool should_clear_soft_references() {
   return false;
 }
 
-static bool should_boost_worker_threads() {
+static bool should_boost_worker_threads(const ZDriverRequest& request) {
   // Boost worker threads if one or more allocations have stalled
   const bool stalled = ZHeap::heap()->is_alloc_stalled();
   if (stalled) {
@@ -145,8 +145,14 @@ static bool should_boost_worker_threads() {
     return true;
   }
 
+  // Boost worker threads if requested together with the GC cycle
+  if (request.boost()) {
+    // Boost
+    return true;
+  }
+
   // Boost worker threads if implied by the GC cause
-  const GCCause::Cause cause = ZCollectedHeap::heap()->gc_cause();
+  const GCCause::Cause cause = request.cause();
   if (cause == GCCause::_wb_full_gc ||
       cause == GCCause::_java_lang_system_gc ||
       cause == GCCause::_metadata_GC_clear_soft_refs) {
@@ -176,10 +182,6 @@ public:
     const bool clear = should_clear_soft_references();
     ZHeap::heap()->set_soft_reference_policy(clear);
 
-    // Set up boost mode
-    const bool boost = should_boost_worker_threads();
-    ZHeap::heap()->set_boost_worker_threads(boost);
-
     ZCollectedHeap::heap()->increment_total_collections(true /* full */);
 
     ZHeap::heap()->mark_start();
@@ -233,6 +235,28 @@ public:
   }
 };
 
+ZDriverRequest::ZDriverRequest() :
+    ZDriverRequest(GCCause::_no_gc) {}
+
+ZDriverRequest::ZDriverRequest(GCCause::Cause cause) :
+    ZDriverRequest(cause, false /* boost */) {}
+
+ZDriverRequest::ZDriverRequest(GCCause::Cause cause, bool boost) :
+    _cause(cause),
+    _boost(boost) {}
+
+bool ZDriverRequest::operator==(const ZDriverRequest& other) const {
+  return _cause == other._cause && _boost == other._boost;
+}
+
+GCCause::Cause ZDriverRequest::cause() const {
+  return _cause;
+}
+
+bool ZDriverRequest::boost() const {
+  return _boost;
+}
+
 ZDriver::ZDriver() :
     _gc_cycle_port(),
     _gc_locker_port() {
@@ -240,8 +264,8 @@ ZDriver::ZDriver() :
   create_and_start();
 }
 
-void ZDriver::collect(GCCause::Cause cause) {
-  switch (cause) {
+void ZDriver::collect(const ZDriverRequest& request) {
+  switch (request.cause()) {
   case GCCause::_wb_young_gc:
   case GCCause::_wb_conc_mark:
   case GCCause::_wb_full_gc:
@@ -252,7 +276,7 @@ void ZDriver::collect(GCCause::Cause cause) {
   case GCCause::_jvmti_force_gc:
   case GCCause::_metadata_GC_clear_soft_refs:
     // Start synchronous GC
-    _gc_cycle_port.send_sync(cause);
+    _gc_cycle_port.send_sync(request);
     break;
 
   case GCCause::_z_timer:
@@ -263,7 +287,7 @@ void ZDriver::collect(GCCause::Cause cause) {
   case GCCause::_z_high_usage:
   case GCCause::_metadata_GC_threshold:
     // Start asynchronous GC
-    _gc_cycle_port.send_async(cause);
+    _gc_cycle_port.send_async(request);
     break;
 
   case GCCause::_gc_locker:
@@ -273,12 +297,12 @@ void ZDriver::collect(GCCause::Cause cause) {
 
   case GCCause::_wb_breakpoint:
     ZBreakpoint::start_gc();
-    _gc_cycle_port.send_async(cause);
+    _gc_cycle_port.send_async(request);
     break;
 
   default:
     // Other causes not supported
-    fatal("Unsupported GC cause (%s)", GCCause::to_string(cause));
+    fatal("Unsupported GC cause (%s)", GCCause::to_string(request.cause()));
     break;
   }
 }
@@ -372,12 +396,16 @@ private:
   ZServiceabilityCycleTracer _tracer;
 
 public:
-  ZDriverGCScope(GCCause::Cause cause) :
+  ZDriverGCScope(const ZDriverRequest& request) :
       _gc_id(),
-      _gc_cause(cause),
-      _gc_cause_setter(ZCollectedHeap::heap(), cause),
+      _gc_cause(request.cause()),
+      _gc_cause_setter(ZCollectedHeap::heap(), _gc_cause),
       _timer(ZPhaseCycle),
       _tracer() {
+    // Set up boost mode
+    const bool boost = should_boost_worker_threads(request);
+    ZHeap::heap()->set_boost_worker_threads(boost);
+
     // Update statistics
     ZStatCycle::at_start();
   }
@@ -411,8 +439,8 @@ public:
     }                                 \
   } while (false)
 
-void ZDriver::gc(GCCause::Cause cause) {
-  ZDriverGCScope scope(cause);
+void ZDriver::gc(const ZDriverRequest& request) {
+  ZDriverGCScope scope(request);
 
   // Phase 1: Pause Mark Start
   pause_mark_start();
@@ -449,15 +477,15 @@ void ZDriver::run_service() {
   // Main loop
   while (!should_terminate()) {
     // Wait for GC request
-    const GCCause::Cause cause = _gc_cycle_port.receive();
-    if (cause == GCCause::_no_gc) {
+    const ZDriverRequest request = _gc_cycle_port.receive();
+    if (request.cause() == GCCause::_no_gc) {
       continue;
     }
 
     ZBreakpoint::at_before_gc();
 
     // Run GC
-    gc(cause);
+    gc(request);
 
     // Notify GC completed
     _gc_cycle_port.ack();
@@ -30,9 +30,27 @@
 
 class VM_ZOperation;
 
+// A request for a GC cycle, carrying the GC cause and whether the cycle
+// should run with boosted worker threads from the start.
+class ZDriverRequest {
+private:
+  GCCause::Cause _cause;
+  bool           _boost;
+
+public:
+  ZDriverRequest();
+  ZDriverRequest(GCCause::Cause cause);
+  ZDriverRequest(GCCause::Cause cause, bool boost);
+
+  bool operator==(const ZDriverRequest& other) const;
+
+  GCCause::Cause cause() const;
+  bool boost() const;
+};
+
 class ZDriver : public ConcurrentGCThread {
 private:
-  ZMessagePort<GCCause::Cause> _gc_cycle_port;
+  ZMessagePort<ZDriverRequest> _gc_cycle_port;
   ZRendezvousPort              _gc_locker_port;
 
   template <typename T> bool pause();
@@ -50,7 +68,7 @@ private:
 
   void check_out_of_memory();
 
-  void gc(GCCause::Cause cause);
+  void gc(const ZDriverRequest& request);
 
 protected:
   virtual void run_service();
@@ -59,7 +77,7 @@ protected:
 public:
   ZDriver();
 
-  void collect(GCCause::Cause cause);
+  void collect(const ZDriverRequest& request);
 };
 
 #endif // SHARE_GC_Z_ZDRIVER_HPP
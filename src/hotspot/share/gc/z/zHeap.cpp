@@ -30,6 +30,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
 #include "gc/z/zHeuristics.hpp"
+#include "gc/z/zLargePages.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -40,12 +41,14 @@
 #include "gc/z/zThread.inline.hpp"
 #include "gc/z/zVerify.hpp"
 #include "gc/z/zWorkers.inline.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "runtime/handshake.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
@@ -66,6 +69,7 @@ ZHeap::ZHeap() :
     _weak_roots_processor(&_workers),
     _relocate(&_workers),
     _relocation_set(&_workers),
+    _relocation_set_history(),
     _unload(&_workers),
     _serviceability(min_capacity(), max_capacity()) {
   // Install global heap instance
@@ -351,7 +355,7 @@ void ZHeap::select_relocation_set() {
   _page_allocator.enable_deferred_delete();
 
   // Register relocatable pages with selector
-  ZRelocationSetSelector selector;
+  ZRelocationSetSelector selector(_relocation_set_history.medium_live_limit());
   ZPageTableIterator pt_iter(&_page_table);
   for (ZPage* page; pt_iter.next(&page);) {
     if (!page->is_relocatable()) {
@@ -389,6 +393,9 @@ void ZHeap::select_relocation_set() {
     _forwarding_table.insert(forwarding);
   }
 
+  // Update selection history
+  _relocation_set_history.update(selector.stats().medium().histogram());
+
   // Update statistics
   ZStatRelocation::set_at_select_relocation_set(selector.stats());
   ZStatHeap::set_at_select_relocation_set(selector.stats());
@@ -430,6 +437,17 @@ void ZHeap::relocate() {
 
   // Update statistics
   ZStatHeap::set_at_relocate_end(_page_allocator.stats(), _object_allocator.relocated());
+
+  // Send event
+  EventZLargePages event;
+  if (event.should_commit()) {
+    const size_t committed = capacity();
+    event.set_mode(ZLargePages::to_string());
+    event.set_largePageSize(ZLargePages::is_enabled() ? ZGranuleSize : os::vm_page_size());
+    event.set_committed(committed);
+    event.set_largePageBacked(ZLargePages::backed(committed));
+    event.commit();
+  }
 }
 
 void ZHeap::object_iterate(ObjectClosure* cl, bool visit_weaks) {
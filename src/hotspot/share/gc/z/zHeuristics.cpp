@@ -56,7 +56,15 @@ void ZHeuristics::set_medium_page_size() {
 size_t ZHeuristics::relocation_headroom() {
   // Calculate headroom needed to avoid in-place relocation. Each worker will try
   // to allocate a small page, and all workers will share a single medium page.
-  return (MAX2(ParallelGCThreads, ConcGCThreads) * ZPageSizeSmall) + ZPageSizeMedium;
+  const size_t headroom = (MAX2(ParallelGCThreads, ConcGCThreads) * ZPageSizeSmall) + ZPageSizeMedium;
+  if (!ZSeparateRelocationPages) {
+    return headroom;
+  }
+
+  // Mutators relocating small objects also allocate shared small relocation
+  // pages, one per CPU or a single one, see use_per_cpu_shared_small_pages().
+  const size_t nrelocation_pages = use_per_cpu_shared_small_pages() ? ZCPU::count() : 1;
+  return headroom + (nrelocation_pages * ZPageSizeSmall);
 }
 
 bool ZHeuristics::use_per_cpu_shared_small_pages() {
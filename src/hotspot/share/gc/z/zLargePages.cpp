@@ -25,6 +25,7 @@
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/z/zLargePages.hpp"
 #include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
 
 ZLargePages::State ZLargePages::_state;
 
@@ -35,6 +36,20 @@ void ZLargePages::initialize() {
   log_info_p(gc, init)("Large Page Support: %s", to_string());
 }
 
+size_t ZLargePages::backed(size_t committed) {
+  switch (_state) {
+  case Explicit:
+    return committed;
+
+  case Transparent:
+    // Huge pages are allocated on a best effort basis
+    return MIN2(pd_transparent_backed(), committed);
+
+  default:
+    return 0;
+  }
+}
+
 const char* ZLargePages::to_string() {
   switch (_state) {
   case Explicit:
@@ -37,6 +37,7 @@ private:
   static State _state;
 
   static void pd_initialize();
+  static size_t pd_transparent_backed();
 
 public:
   static void initialize();
@@ -45,6 +46,9 @@ public:
   static bool is_explicit();
   static bool is_transparent();
 
+  // Number of bytes of the committed memory backed by large pages
+  static size_t backed(size_t committed);
+
   static const char* to_string();
 };
 
@@ -67,6 +67,11 @@ static const ZStatSubPhase ZSubPhaseConcurrentMarkTryFlush("Concurrent Mark Try
 static const ZStatSubPhase ZSubPhaseConcurrentMarkTryTerminate("Concurrent Mark Try Terminate");
 static const ZStatSubPhase ZSubPhaseMarkTryComplete("Pause Mark Try Complete");
 
+static const ZStatCounter ZCounterMarkStealLocal("Mark", "Steal Local", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkStealGlobal("Mark", "Steal Global", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkStealFailed("Mark", "Steal Failed", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterMarkTerminateAttempt("Mark", "Terminate Attempt", ZStatUnitOpsPerSecond);
+
 ZMark::ZMark(ZWorkers* workers, ZPageTable* page_table) :
     _workers(workers),
     _page_table(page_table),
@@ -359,6 +364,7 @@ bool ZMark::try_steal_local(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks)
     if (stack != NULL) {
       // Success, install the stolen stack
       stacks->install(&_stripes, stripe, stack);
+      ZStatInc(ZCounterMarkStealLocal);
       return true;
     }
   }
@@ -376,6 +382,7 @@ bool ZMark::try_steal_global(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks
     if (stack != NULL) {
       // Success, install the stolen stack
       stacks->install(&_stripes, stripe, stack);
+      ZStatInc(ZCounterMarkStealGlobal);
       return true;
     }
   }
@@ -385,7 +392,12 @@ bool ZMark::try_steal_global(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks
 }
 
 bool ZMark::try_steal(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks) {
-  return try_steal_local(stripe, stacks) || try_steal_global(stripe, stacks);
+  if (try_steal_local(stripe, stacks) || try_steal_global(stripe, stacks)) {
+    return true;
+  }
+
+  ZStatInc(ZCounterMarkStealFailed);
+  return false;
 }
 
 void ZMark::idle() const {
@@ -450,6 +462,7 @@ bool ZMark::try_proactive_flush() {
 
 bool ZMark::try_terminate() {
   ZStatTimer timer(ZSubPhaseConcurrentMarkTryTerminate);
+  ZStatInc(ZCounterMarkTerminateAttempt);
 
   if (_terminate.enter_stage0()) {
     // Last thread entered stage 0, flush
@@ -22,15 +22,52 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkStackAllocator.hpp"
+#include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "memory/allocation.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+static const ZStatCounter ZCounterMarkStackHeapAllocation("Memory", "Mark Stack Heap Allocation", ZStatUnitOpsPerSecond);
+
+ZMarkStack* ZMarkStackHeap::alloc() {
+  ZStatInc(ZCounterMarkStackHeapAllocation);
+  void* const addr = AllocateHeap(sizeof(ZMarkStack), mtGC);
+  ZMarkStack* const stack = new (addr) ZMarkStack();
+  assert(contains(stack), "Should not be in mark stack space");
+  return stack;
+}
+
+void ZMarkStackHeap::free(ZMarkStack* stack) {
+  assert(contains(stack), "Should not be in mark stack space");
+  stack->~ZMarkStack();
+  FreeHeap(stack);
+}
+
 ZMarkStripe::ZMarkStripe() :
     _published(),
-    _overflowed() {}
+    _overflowed(),
+    _heap_lock(),
+    _heap_overflowed(NULL) {}
+
+void ZMarkStripe::publish_heap_stack(ZMarkStack* stack) {
+  ZLocker<ZLock> locker(&_heap_lock);
+  *stack->next_addr() = _heap_overflowed;
+  Atomic::store(&_heap_overflowed, stack);
+}
+
+ZMarkStack* ZMarkStripe::steal_heap_stack() {
+  ZLocker<ZLock> locker(&_heap_lock);
+  ZMarkStack* const stack = _heap_overflowed;
+  if (stack != NULL) {
+    Atomic::store(&_heap_overflowed, stack->next());
+    *stack->next_addr() = NULL;
+  }
+  return stack;
+}
 
 ZMarkStripeSet::ZMarkStripeSet() :
     _nstripes(0),
@@ -101,7 +138,8 @@ ZMarkStack* ZMarkThreadLocalStacks::allocate_stack(ZMarkStackAllocator* allocato
     // Allocate new magazine
     _magazine = allocator->alloc_magazine();
     if (_magazine == NULL) {
-      return NULL;
+      // Out of mark stack space, continue with a stack from the C heap
+      return ZMarkStackHeap::alloc();
     }
   }
 
@@ -118,6 +156,12 @@ ZMarkStack* ZMarkThreadLocalStacks::allocate_stack(ZMarkStackAllocator* allocato
 }
 
 void ZMarkThreadLocalStacks::free_stack(ZMarkStackAllocator* allocator, ZMarkStack* stack) {
+  if (ZMarkStackHeap::contains(stack)) {
+    // Stacks from the C heap are never reused
+    ZMarkStackHeap::free(stack);
+    return;
+  }
+
   for (;;) {
     if (_magazine == NULL) {
       // Convert stack into a new magazine
@@ -25,6 +25,7 @@
 #define SHARE_GC_Z_ZMARKSTACK_HPP
 
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zLock.hpp"
 #include "gc/z/zMarkStackEntry.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -74,10 +75,27 @@ using ZMarkStackMagazineList = ZStackList<ZMarkStackMagazine>;
 static_assert(sizeof(ZMarkStack) == ZMarkStackSize, "ZMarkStack size mismatch");
 static_assert(sizeof(ZMarkStackMagazine) <= ZMarkStackSize, "ZMarkStackMagazine size too large");
 
+// Mark stacks are normally allocated from the mark stack space. If that
+// space is exhausted, marking continues using stacks allocated from the
+// C heap. These can't be encoded in a ZStackList, so they are never turned
+// into magazines, are published on a separate locked list per stripe, and
+// are freed as soon as they become empty.
+class ZMarkStackHeap : public AllStatic {
+public:
+  static ZMarkStack* alloc();
+  static void free(ZMarkStack* stack);
+  static bool contains(const ZMarkStack* stack);
+};
+
 class ZMarkStripe {
 private:
   ZCACHE_ALIGNED ZMarkStackList _published;
   ZCACHE_ALIGNED ZMarkStackList _overflowed;
+  ZCACHE_ALIGNED ZLock          _heap_lock;
+  ZMarkStack* volatile          _heap_overflowed;
+
+  void publish_heap_stack(ZMarkStack* stack);
+  ZMarkStack* steal_heap_stack();
 
 public:
   ZMarkStripe();
@@ -24,9 +24,11 @@
 #ifndef SHARE_GC_Z_ZMARKSTACK_INLINE_HPP
 #define SHARE_GC_Z_ZMARKSTACK_INLINE_HPP
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zMarkStack.hpp"
 #include "utilities/debug.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 
 template <typename T, size_t S>
 inline ZStack<T, S>::ZStack() :
@@ -156,8 +158,13 @@ inline T* ZStackList<T>::pop() {
   }
 }
 
+inline bool ZMarkStackHeap::contains(const ZMarkStack* stack) {
+  const uintptr_t addr = (uintptr_t)stack;
+  return addr < ZMarkStackSpaceStart || addr >= ZMarkStackSpaceStart + ZMarkStackSpaceLimit;
+}
+
 inline bool ZMarkStripe::is_empty() const {
-  return _published.is_empty() && _overflowed.is_empty();
+  return _published.is_empty() && _overflowed.is_empty() && Atomic::load(&_heap_overflowed) == NULL;
 }
 
 inline void ZMarkStripe::publish_stack(ZMarkStack* stack, bool publish) {
@@ -167,7 +174,9 @@ inline void ZMarkStripe::publish_stack(ZMarkStack* stack, bool publish) {
   // to publish stacks that overflowed. The intention here is to avoid
   // contention between mutators and GC workers as much as possible, while
   // still allowing GC workers to help out and steal work from each other.
-  if (publish) {
+  if (ZMarkStackHeap::contains(stack)) {
+    publish_heap_stack(stack);
+  } else if (publish) {
     _published.push(stack);
   } else {
     _overflowed.push(stack);
@@ -181,6 +190,13 @@ inline ZMarkStack* ZMarkStripe::steal_stack() {
     return stack;
   }
 
+  if (Atomic::load(&_heap_overflowed) != NULL) {
+    ZMarkStack* const heap_stack = steal_heap_stack();
+    if (heap_stack != NULL) {
+      return heap_stack;
+    }
+  }
+
   return _published.pop();
 }
 
@@ -38,7 +38,8 @@ ZMarkStackSpace::ZMarkStackSpace() :
     _expand_lock(),
     _start(0),
     _top(0),
-    _end(0) {
+    _end(0),
+    _exhausted(false) {
   assert(ZMarkStackSpaceLimit >= ZMarkStackSpaceExpandSize, "ZMarkStackSpaceLimit too small");
 
   // Reserve address space
@@ -96,11 +97,16 @@ uintptr_t ZMarkStackSpace::expand_and_alloc_space(size_t size) {
   const size_t old_size = _end - _start;
   const size_t new_size = old_size + expand_size;
   if (new_size > ZMarkStackSpaceLimit) {
-    // Expansion limit reached. This is a fatal error since we
-    // currently can't recover from running out of mark stack space.
-    fatal("Mark stack space exhausted. Use -XX:ZMarkStackSpaceLimit=<size> to increase the "
-          "maximum number of bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M.",
-          ZMarkStackSpaceLimit / M);
+    // Expansion limit reached. Marking continues using mark stacks
+    // allocated from the C heap, see ZMarkStackHeap.
+    if (!Atomic::load(&_exhausted)) {
+      log_info(gc, marking)("Mark stack space exhausted, using C heap for mark stacks. Use "
+                            "-XX:ZMarkStackSpaceLimit=<size> to increase the maximum number of "
+                            "bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M.",
+                            ZMarkStackSpaceLimit / M);
+      Atomic::store(&_exhausted, true);
+    }
+    return 0;
   }
 
   log_debug(gc, marking)("Expanding mark stack space: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
@@ -123,6 +129,11 @@ uintptr_t ZMarkStackSpace::alloc(size_t size) {
     return addr;
   }
 
+  if (Atomic::load(&_exhausted)) {
+    // Don't contend on the expand lock once the space is exhausted
+    return 0;
+  }
+
   return expand_and_alloc_space(size);
 }
 
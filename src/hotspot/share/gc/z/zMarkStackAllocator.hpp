@@ -34,6 +34,7 @@ private:
   uintptr_t          _start;
   volatile uintptr_t _top;
   volatile uintptr_t _end;
+  volatile bool      _exhausted;
 
   void expand();
 
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "gc/z/zNMethodTableEntry.hpp"
 #include "gc/z/zNMethodTableIteration.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "memory/iterator.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
@@ -32,8 +33,22 @@
 ZNMethodTableIteration::ZNMethodTableIteration() :
     _table(NULL),
     _size(0),
+    _partition_size(0),
     _claimed(0) {}
 
+size_t ZNMethodTableIteration::calculate_partition_size(size_t size) {
+  // Partitions span at least two cache lines. This number is just a guess,
+  // but seems to work well for small tables. Large tables, with hundreds of
+  // thousands of nmethods, are split into a fixed number of partitions per
+  // worker instead, to keep contention on the claim counter low while still
+  // leaving enough partitions for workers to balance the load.
+  const size_t min_partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
+  const size_t max_partition_size = 4 * K;
+  const size_t nworkers = MAX2(ParallelGCThreads, ConcGCThreads);
+  const size_t partition_size = size / (nworkers * 16);
+  return clamp(partition_size, min_partition_size, max_partition_size);
+}
+
 bool ZNMethodTableIteration::in_progress() const {
   return _table != NULL;
 }
@@ -43,6 +58,7 @@ void ZNMethodTableIteration::nmethods_do_begin(ZNMethodTableEntry* table, size_t
 
   _table = table;
   _size = size;
+  _partition_size = calculate_partition_size(size);
   _claimed = 0;
 }
 
@@ -55,9 +71,8 @@ void ZNMethodTableIteration::nmethods_do_end() {
 
 void ZNMethodTableIteration::nmethods_do(NMethodClosure* cl) {
   for (;;) {
-    // Claim table partition. Each partition is currently sized to span
-    // two cache lines. This number is just a guess, but seems to work well.
-    const size_t partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
+    // Claim table partition
+    const size_t partition_size = _partition_size;
     const size_t partition_start = MIN2(Atomic::fetch_and_add(&_claimed, partition_size), _size);
     const size_t partition_end = MIN2(partition_start + partition_size, _size);
     if (partition_start == partition_end) {
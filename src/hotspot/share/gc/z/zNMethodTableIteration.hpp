@@ -33,8 +33,11 @@ class ZNMethodTableIteration {
 private:
   ZNMethodTableEntry*            _table;
   size_t                         _size;
+  size_t                         _partition_size;
   ZCACHE_ALIGNED volatile size_t _claimed;
 
+  static size_t calculate_partition_size(size_t size);
+
 public:
   ZNMethodTableIteration();
 
@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeuristics.hpp"
@@ -47,7 +48,8 @@ ZObjectAllocator::ZObjectAllocator() :
     _alloc_for_relocation(0),
     _undo_alloc_for_relocation(0),
     _shared_medium_page(NULL),
-    _shared_small_page(NULL) {}
+    _shared_small_page(NULL),
+    _shared_small_relocation_page(NULL) {}
 
 ZPage** ZObjectAllocator::shared_small_page_addr() {
   return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_small_page.addr(0);
@@ -57,6 +59,10 @@ ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
   return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_small_page.addr(0);
 }
 
+ZPage** ZObjectAllocator::shared_small_relocation_page_addr() {
+  return _use_per_cpu_shared_small_pages ? _shared_small_relocation_page.addr() : _shared_small_relocation_page.addr(0);
+}
+
 void ZObjectAllocator::register_alloc_for_relocation(const ZPageTable* page_table, uintptr_t addr, size_t size) {
   const ZPage* const page = page_table->get(addr);
   const size_t aligned_size = align_up(size, page->object_alignment());
@@ -178,7 +184,13 @@ uintptr_t ZObjectAllocator::alloc_object_for_relocation(const ZPageTable* page_t
   ZAllocationFlags flags;
   flags.set_non_blocking();
 
-  const uintptr_t addr = alloc_object(size, flags);
+  // With ZSeparateRelocationPages, small objects relocated by mutators go
+  // to separate shared pages, so that relocation storms don't contend with
+  // TLAB refills and other allocations on the shared small pages. These
+  // pages are part of ZHeuristics::relocation_headroom().
+  const uintptr_t addr = (ZSeparateRelocationPages && size <= ZObjectSizeLimitSmall)
+      ? alloc_object_in_shared_page(shared_small_relocation_page_addr(), ZPageTypeSmall, ZPageSizeSmall, size, flags)
+      : alloc_object(size, flags);
   if (addr != 0) {
     register_alloc_for_relocation(page_table, addr, size);
   }
@@ -264,4 +276,5 @@ void ZObjectAllocator::retire_pages() {
   // Reset allocation pages
   _shared_medium_page.set(NULL);
   _shared_small_page.set_all(NULL);
+  _shared_small_relocation_page.set_all(NULL);
 }
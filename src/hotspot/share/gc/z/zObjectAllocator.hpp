@@ -39,9 +39,11 @@ private:
   ZPerCPU<size_t>    _undo_alloc_for_relocation;
   ZContended<ZPage*> _shared_medium_page;
   ZPerCPU<ZPage*>    _shared_small_page;
+  ZPerCPU<ZPage*>    _shared_small_relocation_page;
 
   ZPage** shared_small_page_addr();
   ZPage* const* shared_small_page_addr() const;
+  ZPage** shared_small_relocation_page_addr();
 
   void register_alloc_for_relocation(const ZPageTable* page_table, uintptr_t addr, size_t size);
   void register_undo_alloc_for_relocation(const ZPage* page, size_t size);
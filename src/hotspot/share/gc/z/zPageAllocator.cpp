@@ -354,15 +354,6 @@ bool ZPageAllocator::commit_page(ZPage* page) {
   return _physical.commit(page->physical_memory());
 }
 
-void ZPageAllocator::uncommit_page(ZPage* page) {
-  if (!ZUncommit) {
-    return;
-  }
-
-  // Uncommit physical memory
-  _physical.uncommit(page->physical_memory());
-}
-
 void ZPageAllocator::map_page(const ZPage* page) const {
   // Map physical memory
   _physical.map(page->start(), page->physical_memory());
@@ -373,6 +364,60 @@ void ZPageAllocator::unmap_page(const ZPage* page) const {
   _physical.unmap(page->start(), page->size());
 }
 
+static int compare_page_start(ZPage** a, ZPage** b) {
+  const uintptr_t start_a = (*a)->start();
+  const uintptr_t start_b = (*b)->start();
+  return start_a < start_b ? -1 : (start_a > start_b ? 1 : 0);
+}
+
+void ZPageAllocator::unmap_uncommit_and_destroy_pages(ZList<ZPage>* pages) {
+  // Sort the pages by address so that pages which are adjacent in virtual
+  // memory can be unmapped together, and collect their physical memory so
+  // that adjacent segments get merged and uncommitted together. This keeps
+  // the number of system calls needed to give a large chunk of memory back
+  // to the operating system low.
+  ZArray<ZPage*> sorted;
+  ZListRemoveIterator<ZPage> iter(pages);
+  for (ZPage* page; iter.next(&page);) {
+    sorted.append(page);
+  }
+  sorted.sort(compare_page_start);
+
+  ZPhysicalMemory pmem;
+  uintptr_t unmap_start = 0;
+  size_t unmap_size = 0;
+
+  ZArrayIterator<ZPage*> sorted_iter(&sorted);
+  for (ZPage* page; sorted_iter.next(&page);) {
+    if (unmap_size > 0 && unmap_start + unmap_size == page->start()) {
+      // Extend range to unmap
+      unmap_size += page->size();
+    } else {
+      if (unmap_size > 0) {
+        _physical.unmap(unmap_start, unmap_size);
+      }
+      unmap_start = page->start();
+      unmap_size = page->size();
+    }
+
+    pmem.add_segments(page->physical_memory());
+  }
+
+  if (unmap_size > 0) {
+    _physical.unmap(unmap_start, unmap_size);
+  }
+
+  if (ZUncommit) {
+    // Uncommit physical memory
+    _physical.uncommit(pmem);
+  }
+
+  ZArrayIterator<ZPage*> destroy_iter(&sorted);
+  for (ZPage* page; destroy_iter.next(&page);) {
+    destroy_page(page);
+  }
+}
+
 void ZPageAllocator::destroy_page(ZPage* page) {
   // Free virtual memory
   _virtual.free(page->virtual_memory());
@@ -753,12 +798,7 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   }
 
   // Unmap, uncommit, and destroy flushed pages
-  ZListRemoveIterator<ZPage> iter(&pages);
-  for (ZPage* page; iter.next(&page);) {
-    unmap_page(page);
-    uncommit_page(page);
-    destroy_page(page);
-  }
+  unmap_uncommit_and_destroy_pages(&pages);
 
   {
     SuspendibleThreadSetJoiner joiner(!ZVerifyViews);
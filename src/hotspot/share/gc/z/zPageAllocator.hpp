@@ -75,12 +75,12 @@ private:
   void decrease_used(size_t size, bool reclaimed);
 
   bool commit_page(ZPage* page);
-  void uncommit_page(ZPage* page);
 
   void map_page(const ZPage* page) const;
   void unmap_page(const ZPage* page) const;
 
   void destroy_page(ZPage* page);
+  void unmap_uncommit_and_destroy_pages(ZList<ZPage>* pages);
 
   bool is_alloc_allowed(size_t size) const;
 
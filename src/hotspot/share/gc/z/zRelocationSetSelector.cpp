@@ -33,22 +33,31 @@
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+ZRelocationSetSelectorHistogram::ZRelocationSetSelectorHistogram() {
+  for (size_t i = 0; i < ZRelocationSetSelectorHistogramBuckets; i++) {
+    _buckets[i] = 0;
+  }
+}
+
 ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats() :
     _npages(0),
     _total(0),
     _live(0),
     _empty(0),
-    _relocate(0) {}
+    _relocate(0),
+    _histogram() {}
 
 ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
                                                          uint8_t page_type,
                                                          size_t page_size,
-                                                         size_t object_size_limit) :
+                                                         size_t object_size_limit,
+                                                         size_t live_limit) :
     _name(name),
     _page_type(page_type),
     _page_size(page_size),
     _object_size_limit(object_size_limit),
     _fragmentation_limit(page_size * (ZFragmentationLimit / 100)),
+    _live_limit(live_limit),
     _live_pages(),
     _forwarding_entries(0),
     _stats() {}
@@ -176,10 +185,10 @@ void ZRelocationSetSelectorGroup::select() {
   event.commit(_page_type, _stats.npages(), _stats.total(), _stats.empty(), _stats.relocate());
 }
 
-ZRelocationSetSelector::ZRelocationSetSelector() :
-    _small("Small", ZPageTypeSmall, ZPageSizeSmall, ZObjectSizeLimitSmall),
-    _medium("Medium", ZPageTypeMedium, ZPageSizeMedium, ZObjectSizeLimitMedium),
-    _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */),
+ZRelocationSetSelector::ZRelocationSetSelector(size_t medium_live_limit) :
+    _small("Small", ZPageTypeSmall, ZPageSizeSmall, ZObjectSizeLimitSmall, SIZE_MAX /* live_limit */),
+    _medium("Medium", ZPageTypeMedium, ZPageSizeMedium, ZObjectSizeLimitMedium, medium_live_limit),
+    _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */, SIZE_MAX /* live_limit */),
     _empty_pages() {}
 
 void ZRelocationSetSelector::select() {
@@ -207,3 +216,68 @@ ZRelocationSetSelectorStats ZRelocationSetSelector::stats() const {
   stats._large = _large.stats();
   return stats;
 }
+
+ZRelocationSetSelectorHistory::ZRelocationSetSelectorHistory() :
+    _medium_live_limit(ZPageSizeMedium) {
+  for (size_t i = 0; i < ZRelocationSetSelectorHistogramBuckets; i++) {
+    _medium[i] = 0.0;
+  }
+}
+
+void ZRelocationSetSelectorHistory::update(const ZRelocationSetSelectorHistogram& medium) {
+  if (ZPageSizeMedium == 0) {
+    // Medium pages disabled
+    return;
+  }
+
+  // Decay the histogram of previous cycles
+  const double alpha = 0.3;
+  for (size_t i = 0; i < ZRelocationSetSelectorHistogramBuckets; i++) {
+    _medium[i] = (_medium[i] * (1.0 - alpha)) + (medium.at(i) * alpha);
+  }
+
+  // Run the same selection as ZRelocationSetSelectorGroup::select_inner() over
+  // the histogram, treating all pages in a bucket as having the bucket's maximum
+  // number of live bytes. Since pages are sorted by live bytes, this also selects
+  // the pages with the most reclaimed bytes per copied byte first.
+  const size_t page_size = ZPageSizeMedium;
+  const size_t fragmentation_limit = page_size * (ZFragmentationLimit / 100);
+  double from_pages = 0.0;
+  double from_live_bytes = 0.0;
+  double selected_from = 0.0;
+  double selected_to = 0.0;
+  size_t selected_bucket = 0;
+
+  for (size_t i = 0; i < ZRelocationSetSelectorHistogramBuckets; i++) {
+    const size_t live_limit = ZRelocationSetSelectorHistogram::bucket_live_limit(i, page_size);
+    if (page_size - live_limit <= fragmentation_limit) {
+      // Not enough garbage to become a candidate
+      break;
+    }
+
+    from_pages += _medium[i];
+    from_live_bytes += _medium[i] * live_limit;
+
+    const double to = ceil(from_live_bytes / (double)(page_size - ZObjectSizeLimitMedium));
+    const double diff_from = from_pages - selected_from;
+    const double diff_to = to - selected_to;
+    const double diff_reclaimable = 100 - percent_of(diff_to, diff_from);
+    if (diff_reclaimable > ZFragmentationLimit) {
+      selected_from = from_pages;
+      selected_to = to;
+      selected_bucket = i;
+    }
+  }
+
+  if (selected_from == 0.0) {
+    // Nothing expected to be selected, don't limit the candidates
+    _medium_live_limit = page_size;
+  } else {
+    // Allow one bucket of slack, since the histogram is both approximate
+    // and based on previous cycles
+    const size_t slack_bucket = MIN2(selected_bucket + 1, ZRelocationSetSelectorHistogramBuckets - 1);
+    _medium_live_limit = ZRelocationSetSelectorHistogram::bucket_live_limit(slack_bucket, page_size);
+  }
+
+  log_debug(gc, reloc)("Medium Page Candidate Live Limit: " SIZE_FORMAT "K", _medium_live_limit / K);
+}
@@ -29,15 +29,33 @@
 
 class ZPage;
 
+const size_t ZRelocationSetSelectorHistogramBuckets = 16;
+
+// Number of live pages per fraction of live bytes in the page
+class ZRelocationSetSelectorHistogram {
+private:
+  size_t _buckets[ZRelocationSetSelectorHistogramBuckets];
+
+public:
+  ZRelocationSetSelectorHistogram();
+
+  static size_t bucket(size_t live, size_t page_size);
+  static size_t bucket_live_limit(size_t bucket, size_t page_size);
+
+  void add(size_t live, size_t page_size);
+  size_t at(size_t bucket) const;
+};
+
 class ZRelocationSetSelectorGroupStats {
   friend class ZRelocationSetSelectorGroup;
 
 private:
-  size_t _npages;
-  size_t _total;
-  size_t _live;
-  size_t _empty;
-  size_t _relocate;
+  size_t                           _npages;
+  size_t                           _total;
+  size_t                           _live;
+  size_t                           _empty;
+  size_t                           _relocate;
+  ZRelocationSetSelectorHistogram  _histogram;
 
 public:
   ZRelocationSetSelectorGroupStats();
@@ -47,6 +65,7 @@ public:
   size_t live() const;
   size_t empty() const;
   size_t relocate() const;
+  const ZRelocationSetSelectorHistogram& histogram() const;
 };
 
 class ZRelocationSetSelectorStats {
@@ -70,6 +89,7 @@ private:
   const size_t                     _page_size;
   const size_t                     _object_size_limit;
   const size_t                     _fragmentation_limit;
+  const size_t                     _live_limit;
   ZArray<ZPage*>                   _live_pages;
   size_t                           _forwarding_entries;
   ZRelocationSetSelectorGroupStats _stats;
@@ -83,7 +103,8 @@ public:
   ZRelocationSetSelectorGroup(const char* name,
                               uint8_t page_type,
                               size_t page_size,
-                              size_t object_size_limit);
+                              size_t object_size_limit,
+                              size_t live_limit);
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
@@ -107,7 +128,7 @@ private:
   size_t relocate() const;
 
 public:
-  ZRelocationSetSelector();
+  ZRelocationSetSelector(size_t medium_live_limit);
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
@@ -125,4 +146,22 @@ public:
   ZRelocationSetSelectorStats stats() const;
 };
 
+// Live histogram of medium pages, decayed over previous cycles. Used to
+// pre-compute the highest number of live bytes a medium page can have and
+// still be expected to be selected for relocation, so that medium pages
+// that are unlikely to be selected never become candidates. This keeps
+// the candidate set, and the work spent sorting and evaluating it, small
+// on heaps with many medium pages.
+class ZRelocationSetSelectorHistory {
+private:
+  double _medium[ZRelocationSetSelectorHistogramBuckets];
+  size_t _medium_live_limit;
+
+public:
+  ZRelocationSetSelectorHistory();
+
+  void update(const ZRelocationSetSelectorHistogram& medium);
+  size_t medium_live_limit() const;
+};
+
 #endif // SHARE_GC_Z_ZRELOCATIONSETSELECTOR_HPP
@@ -28,6 +28,24 @@
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocationSetSelector.hpp"
 
+inline size_t ZRelocationSetSelectorHistogram::bucket(size_t live, size_t page_size) {
+  return MIN2(live * ZRelocationSetSelectorHistogramBuckets / page_size,
+              ZRelocationSetSelectorHistogramBuckets - 1);
+}
+
+inline size_t ZRelocationSetSelectorHistogram::bucket_live_limit(size_t bucket, size_t page_size) {
+  return (bucket + 1) * (page_size / ZRelocationSetSelectorHistogramBuckets);
+}
+
+inline void ZRelocationSetSelectorHistogram::add(size_t live, size_t page_size) {
+  _buckets[bucket(live, page_size)]++;
+}
+
+inline size_t ZRelocationSetSelectorHistogram::at(size_t bucket) const {
+  assert(bucket < ZRelocationSetSelectorHistogramBuckets, "Invalid bucket");
+  return _buckets[bucket];
+}
+
 inline size_t ZRelocationSetSelectorGroupStats::npages() const {
   return _npages;
 }
@@ -48,6 +66,10 @@ inline size_t ZRelocationSetSelectorGroupStats::relocate() const {
   return _relocate;
 }
 
+inline const ZRelocationSetSelectorHistogram& ZRelocationSetSelectorGroupStats::histogram() const {
+  return _histogram;
+}
+
 inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::small() const {
   return _small;
 }
@@ -66,13 +88,14 @@ inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   const size_t live = page->live_bytes();
   const size_t garbage = size - live;
 
-  if (garbage > _fragmentation_limit) {
+  if (garbage > _fragmentation_limit && live <= _live_limit) {
     _live_pages.append(page);
   }
 
   _stats._npages++;
   _stats._total += size;
   _stats._live += live;
+  _stats._histogram.add(live, size);
 }
 
 inline void ZRelocationSetSelectorGroup::register_empty_page(ZPage* page) {
@@ -157,4 +180,8 @@ inline size_t ZRelocationSetSelector::forwarding_entries() const {
   return _small.forwarding_entries() + _medium.forwarding_entries();
 }
 
+inline size_t ZRelocationSetSelectorHistory::medium_live_limit() const {
+  return _medium_live_limit;
+}
+
 #endif // SHARE_GC_Z_ZRELOCATIONSETSELECTOR_INLINE_HPP
@@ -1186,6 +1186,17 @@ void ZStatRelocation::print(const char* name,
                       selector_group.empty() / M,
                       selector_group.relocate() / M,
                       in_place_count);
+
+  LogTarget(Debug, gc, reloc) lt;
+  if (lt.is_enabled()) {
+    // Live histogram, in 1/16 page steps
+    char buf[ZRelocationSetSelectorHistogramBuckets * 24];
+    size_t pos = 0;
+    for (size_t i = 0; i < ZRelocationSetSelectorHistogramBuckets; i++) {
+      pos += os::snprintf(buf + pos, sizeof(buf) - pos, " " SIZE_FORMAT, selector_group.histogram().at(i));
+    }
+    lt.print("%s Pages Live Histogram:%s", name, buf);
+  }
 }
 
 void ZStatRelocation::print() {
@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderData.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeBehaviours.hpp"
@@ -36,6 +37,8 @@
 #include "gc/z/zUnload.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "oops/access.inline.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
 
 static const ZStatSubPhase ZSubPhaseConcurrentClassesUnlink("Concurrent Classes Unlink");
 static const ZStatSubPhase ZSubPhaseConcurrentClassesPurge("Concurrent Classes Purge");
@@ -77,6 +80,15 @@ class ZIsUnloadingBehaviour : public IsUnloadingBehaviour {
 public:
   virtual bool is_unloading(CompiledMethod* method) const {
     nmethod* const nm = method->as_nmethod();
+
+    // If the class loader of the method holder is being unloaded, then so
+    // is the nmethod. This avoids taking the nmethod lock and scanning the
+    // oops for all nmethods of unloaded class loaders.
+    Method* const m = nm->method();
+    if (m != NULL && m->method_holder()->class_loader_data()->is_unloading()) {
+      return true;
+    }
+
     ZReentrantLock* const lock = ZNMethod::lock_for_nmethod(nm);
     ZLocker<ZReentrantLock> locker(lock);
     ZIsUnloadingOopClosure cl;
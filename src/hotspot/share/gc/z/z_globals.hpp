@@ -62,6 +62,10 @@
   product(bool, ZStressRelocateInPlace, false, DIAGNOSTIC,                  \
           "Always relocate pages in-place")                                 \
                                                                             \
+  product(bool, ZSeparateRelocationPages, false, DIAGNOSTIC,                \
+          "Let mutators relocate small objects to shared pages of their "   \
+          "own instead of the shared small allocation pages")               \
+                                                                            \
   product(bool, ZVerifyViews, false, DIAGNOSTIC,                            \
           "Verify heap view accesses")                                      \
                                                                             \
@@ -27,6 +27,7 @@
 #include "jfr/recorder/service/jfrEventThrottler.hpp"
 #include "jfr/utilities/jfrSpinlockHelper.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 
 constexpr static const JfrSamplerParams _disabled_params = {
                                                              0, // sample points per window
@@ -35,43 +36,82 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = NULL;
+// One throttler per event type declared with throttle="true" in metadata.xml,
+// created when the event is first configured.
+static JfrEventThrottler* volatile _throttlers[LAST_EVENT_ID + 1] = { NULL };
 
-JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
+// The names of the event types declared with throttle="true" in metadata.xml,
+// NULL for event types that can't be throttled.
+static const char* throttled_event_name(JfrEventId event_id) {
+  switch (event_id) {
+    case JfrThreadParkEvent:
+      return "jdk.ThreadPark";
+    case JfrJavaMonitorEnterEvent:
+      return "jdk.JavaMonitorEnter";
+    case JfrJavaMonitorWaitEvent:
+      return "jdk.JavaMonitorWait";
+    case JfrObjectAllocationSampleEvent:
+      return "jdk.ObjectAllocationSample";
+    default:
+      return NULL;
+  }
+}
+
+JfrEventThrottler::JfrEventThrottler(JfrEventId event_id, const char* event_name) :
   JfrAdaptiveSampler(),
   _last_params(),
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
   _event_id(event_id),
+  _event_name(event_name),
   _disabled(false),
   _update(false) {}
 
 bool JfrEventThrottler::create() {
-  assert(_throttler == NULL, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != NULL && _throttler->initialize();
+  assert(_throttlers[JfrObjectAllocationSampleEvent] == NULL, "invariant");
+  return for_event(JfrObjectAllocationSampleEvent, true) != NULL;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = NULL;
+  for (u4 i = 0; i <= LAST_EVENT_ID; ++i) {
+    delete _throttlers[i];
+    _throttlers[i] = NULL;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
-JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != NULL, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : NULL;
+JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id, bool create /* false */) {
+  assert((u4)event_id <= LAST_EVENT_ID, "invariant");
+  JfrEventThrottler* throttler = Atomic::load_acquire(&_throttlers[event_id]);
+  if (throttler != NULL || !create) {
+    return throttler;
+  }
+  const char* const event_name = throttled_event_name(event_id);
+  if (event_name == NULL) {
+    return NULL;
+  }
+  JfrEventThrottler* const created = new JfrEventThrottler(event_id, event_name);
+  if (created == NULL || !created->initialize()) {
+    delete created;
+    return NULL;
+  }
+  throttler = Atomic::cmpxchg(&_throttlers[event_id], (JfrEventThrottler*)NULL, created);
+  if (throttler != NULL) {
+    // Lost the race, use the installed one.
+    delete created;
+    return throttler;
+  }
+  return created;
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if ((u4)event_id > LAST_EVENT_ID) {
     return;
   }
-  assert(_throttler != NULL, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  JfrEventThrottler* const throttler = for_event(event_id, true);
+  if (throttler != NULL) {
+    throttler->configure(sample_size, period_ms);
+  }
 }
 
 /*
@@ -91,10 +131,11 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 }
 
 // Predicate for event selection.
+// Events that have not been configured yet are accepted.
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == NULL) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -240,16 +281,13 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
- *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(const char* event_name, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != NULL, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(expired->sample_size(), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("%s: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      event_name, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : (double)expired->sample_size() / (double)expired->population_size(),
       expired->params().window_duration_ms);
   }
@@ -268,7 +306,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != NULL, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_name, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
@@ -28,7 +28,10 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
@@ -107,39 +110,48 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
     JfrStackTrace* stacktrace = _table[i];
     while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = const_cast<JfrStackTrace*>(stacktrace->next());
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
+    free_entries();
     _entries = 0;
   }
   _last_entries = _entries;
   return count;
 }
 
-size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
+// Lookups in add_trace() traverse the chains without holding JfrStacktrace_lock,
+// so the entries are unlinked first and only deleted after a synchronization.
+void JfrStackTraceRepository::free_entries() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const chains = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    chains[i] = _table[i];
+    Atomic::release_store(&_table[i], (JfrStackTrace*)NULL);
   }
+  GlobalCounter::write_synchronize();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
+    JfrStackTrace* stacktrace = chains[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       delete stacktrace;
       stacktrace = next;
     }
   }
-  memset(repo._table, 0, sizeof(repo._table));
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, chains);
+}
+
+size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  if (repo._entries == 0) {
+    return 0;
+  }
+  repo.free_entries();
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -197,16 +209,28 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
   }
 }
 
+static const JfrStackTrace* find(const JfrStackTrace* chain, const JfrStackTrace& stacktrace) {
+  while (chain != NULL && !chain->equals(stacktrace)) {
+    chain = chain->next();
+  }
+  return chain;
+}
+
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
-  while (table_entry != NULL) {
-    if (table_entry->equals(stacktrace)) {
+  {
+    // Most traces are already known. Look for them without the lock, entries
+    // are only deleted after a GlobalCounter synchronization (see free_entries()).
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* const table_entry = find(Atomic::load_acquire(&_table[index]), stacktrace);
+    if (table_entry != NULL) {
       return table_entry->id();
     }
-    table_entry = table_entry->next();
+  }
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  const JfrStackTrace* const table_entry = find(_table[index], stacktrace);
+  if (table_entry != NULL) {
+    return table_entry->id();
   }
 
   if (!stacktrace.have_lineno()) {
@@ -214,7 +238,7 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
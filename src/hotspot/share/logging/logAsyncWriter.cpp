@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logConfiguration.hpp"
+#include "logging/logFileOutput.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+
+AsyncLogWriter* AsyncLogWriter::_instance = NULL;
+
+AsyncLogWriter::AsyncLogWriter()
+  : NonJavaThread(),
+    _lock(1), _sem(0), _io_sem(1),
+    _head(NULL), _tail(NULL), _buffer_size(0),
+    _buffer_max_size(AsyncLogBufferSize) {
+}
+
+void AsyncLogWriter::print_on(outputStream* st) const {
+  st->print("\"%s\" ", name());
+  Thread::print_on(st);
+  st->cr();
+}
+
+bool AsyncLogWriter::enqueue_locked(AsyncLogMessage* msg) {
+  LogFileOutput* output = msg->_output;
+  size_t size = msg->size();
+  if (_buffer_size + size > _buffer_max_size) {
+    output->_async_dropped_messages++;
+    return false;
+  }
+
+  if (output->_async_dropped_messages > 0) {
+    // Report the dropped messages in front of the first message that fits.
+    // The note is small, so it is not charged against the budget.
+    char buf[64];
+    jio_snprintf(buf, sizeof(buf), "%u messages dropped due to async logging",
+                 output->_async_dropped_messages);
+    char* note = os::strdup(buf, mtLogging);
+    if (note != NULL) {
+      AsyncLogMessage* dropped = new AsyncLogMessage(output, msg->_decorations, note);
+      dropped->_decorations.set_level(LogLevel::Warning);
+      dropped->_next = msg;
+      msg = dropped;
+      output->_async_dropped_messages = 0;
+    }
+  }
+
+  if (_tail == NULL) {
+    _head = msg;
+  } else {
+    _tail->_next = msg;
+  }
+  _tail = msg->_next != NULL ? msg->_next : msg;
+  _buffer_size += size;
+  return true;
+}
+
+bool AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  char* copy = os::strdup(msg, mtLogging);
+  if (copy == NULL) {
+    return false;
+  }
+  AsyncLogMessage* m = new AsyncLogMessage(&output, decorations, copy);
+
+  _lock.wait();
+  bool enqueued = enqueue_locked(m);
+  _lock.signal();
+
+  if (enqueued) {
+    _sem.signal();
+  } else {
+    delete m;
+  }
+  return enqueued;
+}
+
+bool AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator) {
+  // The lines of a multi-line message are enqueued one by one, and may be
+  // interleaved with messages from other threads when they are written out.
+  bool enqueued = true;
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    enqueued &= enqueue(output, msg_iterator.decorations(), msg_iterator.message());
+  }
+  return enqueued;
+}
+
+AsyncLogMessage* AsyncLogWriter::take_all() {
+  _lock.wait();
+  AsyncLogMessage* head = _head;
+  _head = NULL;
+  _tail = NULL;
+  _buffer_size = 0;
+  _lock.signal();
+  return head;
+}
+
+void AsyncLogWriter::write_all() {
+  _io_sem.wait();
+  AsyncLogMessage* msg = take_all();
+  while (msg != NULL) {
+    AsyncLogMessage* next = msg->_next;
+    msg->_output->write_blocking(msg->_decorations, msg->_message);
+    delete msg;
+    msg = next;
+  }
+  _io_sem.signal();
+}
+
+void AsyncLogWriter::run() {
+  while (true) {
+    // Every enqueued message signals _sem, so after a batch has been written
+    // the writer may wake up a few times to an empty buffer.
+    _sem.wait();
+    write_all();
+  }
+}
+
+void AsyncLogWriter::initialize() {
+  if (!LogConfiguration::is_async_mode()) {
+    return;
+  }
+
+  assert(_instance == NULL, "initialize() should only be invoked once");
+  AsyncLogWriter* self = new AsyncLogWriter();
+  if (os::create_thread(self, os::asynclog_thread)) {
+    // Publish the instance before starting the thread; file outputs enqueue
+    // their messages from here on.
+    Atomic::release_store_fence(&_instance, self);
+    os::start_thread(self);
+    log_debug(logging, thread)("Async logging thread started.");
+  } else {
+    log_warning(logging, thread)("Async logging failed to create thread. Falling back to synchronous logging.");
+  }
+}
+
+void AsyncLogWriter::flush() {
+  AsyncLogWriter* writer = Atomic::load_acquire(&_instance);
+  if (writer != NULL) {
+    writer->write_all();
+  }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "logging/logDecorations.hpp"
+#include "logging/logMessageBuffer.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/nonJavaThread.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+
+class LogFileOutput;
+
+// A log message waiting to be written by the AsyncLogWriter. The decorations
+// are captured when the message is logged, so timestamps and thread ids
+// describe the logging thread and not the writer.
+class AsyncLogMessage : public CHeapObj<mtLogging> {
+  friend class AsyncLogWriter;
+
+  LogFileOutput*  _output;
+  LogDecorations  _decorations;
+  char*           _message;
+  AsyncLogMessage* _next;
+
+  AsyncLogMessage(LogFileOutput* output, const LogDecorations& decorations, char* message)
+    : _output(output), _decorations(decorations), _message(message), _next(NULL) { }
+
+  ~AsyncLogMessage() {
+    os::free(_message);
+  }
+
+  size_t size() const {
+    return sizeof(AsyncLogMessage) + strlen(_message) + 1;
+  }
+};
+
+// The AsyncLogWriter takes over the file I/O of file outputs when
+// asynchronous logging is enabled with -Xlog:async. Logging threads only copy
+// the message into a FIFO buffer and return; the writer thread drains the
+// buffer and writes the messages in the order they were logged. The buffer
+// is bounded by AsyncLogBufferSize. Messages that do not fit are dropped, and
+// the number of dropped messages is reported on the affected output once the
+// buffer has room again.
+class AsyncLogWriter : public NonJavaThread {
+  friend class AsyncLogTest;
+
+  static AsyncLogWriter* _instance;
+
+  // Protects the buffer. A semaphore rather than a Mutex, since messages are
+  // logged with arbitrary locks held.
+  Semaphore _lock;
+  // Signalled once for every enqueued message.
+  Semaphore _sem;
+  // Held while writing out a batch of messages, so that a flush can not
+  // overtake messages the writer thread has already taken from the buffer.
+  Semaphore _io_sem;
+
+  AsyncLogMessage* _head;
+  AsyncLogMessage* _tail;
+  size_t           _buffer_size;
+  const size_t     _buffer_max_size;
+
+  AsyncLogWriter();
+
+  bool enqueue_locked(AsyncLogMessage* msg);
+  AsyncLogMessage* take_all();
+  void write_all();
+
+  void run();
+
+ public:
+  char* name() const { return (char*)"AsyncLog Thread"; }
+  void print_on(outputStream* st) const;
+
+  // Enqueues a message for the given output. Returns false if the message was
+  // dropped because the buffer is full.
+  bool enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
+  bool enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator);
+
+  static AsyncLogWriter* instance() {
+    return _instance;
+  }
+
+  // Starts the writer thread if -Xlog:async was given.
+  static void initialize();
+
+  // Writes out all pending messages before returning. Called before outputs
+  // are reconfigured or deleted, and at VM exit.
+  static void flush();
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
@@ -47,6 +47,8 @@ class LogDecorations {
 
  public:
   LogDecorations(LogLevelType level, const LogTagSet& tagset, const LogDecorators& decorators);
+  // Copies rebase the decoration offsets onto the copy's own buffer.
+  LogDecorations(const LogDecorations& other);
 
   void set_level(LogLevelType level) {
     _level = level;
@@ -32,6 +32,7 @@ class LogDecorations;
 
 // The log file output, with support for file rotation based on a target size.
 class LogFileOutput : public LogFileStreamOutput {
+  friend class AsyncLogWriter;
  private:
   static const char* const FileOpenMode;
   static const char* const FileCountOptionKey;
@@ -63,6 +64,10 @@ class LogFileOutput : public LogFileStreamOutput {
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
+  // Messages dropped by the AsyncLogWriter since it last accepted one for
+  // this output, protected by the writer's lock.
+  uint _async_dropped_messages;
+
   void archive();
   void rotate();
   bool parse_options(const char* options, outputStream* errstream);
@@ -85,6 +90,8 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual bool initialize(const char* options, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
+  // Writes the message to the file in the calling thread, bypassing the AsyncLogWriter.
+  int write_blocking(const LogDecorations& decorations, const char* msg);
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
@@ -676,10 +676,12 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
 
   length = length < CodeCacheMinBlockLength ? CodeCacheMinBlockLength : length;
 
-  // Search for best-fitting block
+  // Search for best-fitting block. With CodeCacheAddressOrderedFit, take the
+  // first block that fits. The freelist is sorted by address, so that is the
+  // lowest one, and code stays packed on fewer pages.
   while(cur != NULL) {
     size_t cur_length = cur->length();
-    if (cur_length == length) {
+    if (cur_length == length || (CodeCacheAddressOrderedFit && cur_length > length)) {
       // We have a perfect fit
       found_block  = cur;
       found_prev   = prev;
@@ -660,7 +660,30 @@ void HeapInspection::find_instances_at_safepoint(Klass* k, GrowableArray<oop>* r
   // Ensure that the heap is parsable
   Universe::heap()->ensure_parsability(false);  // no need to retire TALBs
 
+  // Try parallel first.
+  WorkGang* gang = Universe::heap()->safepoint_workers();
+  if (gang != NULL && gang->active_workers() > 1) {
+    ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+    if (poi != NULL) {
+      ParFindInstanceTask task(poi, k, result);
+      gang->run_task(&task);
+      delete poi;
+      return;
+    }
+  }
+
   // Iterate over objects in the heap
   FindInstanceClosure fic(k, result);
   Universe::heap()->object_iterate(&fic);
 }
+
+void ParFindInstanceTask::work(uint worker_id) {
+  ResourceMark rm;
+  GrowableArray<oop> local_result;
+  FindInstanceClosure fic(_klass, &local_result);
+  _poi->object_iterate(&fic, worker_id);
+  if (local_result.is_nonempty()) {
+    MutexLocker x(&_mutex);
+    _result->appendAll(&local_result);
+  }
+}
@@ -258,4 +258,27 @@ class ParHeapInspectTask : public AbstractGangTask {
   virtual void work(uint worker_id);
 };
 
+// Parallel search for instances of a klass. Every worker collects the
+// instances it finds in a local array and appends them to the shared
+// result when it is done, so the result is in no particular order.
+class ParFindInstanceTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  Klass* _klass;
+  GrowableArray<oop>* _result;
+  Mutex _mutex;
+
+ public:
+  ParFindInstanceTask(ParallelObjectIterator* poi,
+                      Klass* k,
+                      GrowableArray<oop>* result) :
+      AbstractGangTask("Finding instances"),
+      _poi(poi),
+      _klass(k),
+      _result(result),
+      _mutex(Mutex::leaf, "Parallel instance search result merge lock") {}
+
+  virtual void work(uint worker_id);
+};
+
 #endif // SHARE_MEMORY_HEAPINSPECTION_HPP
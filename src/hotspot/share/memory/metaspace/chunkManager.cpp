@@ -236,6 +236,18 @@ void ChunkManager::return_chunk(Metachunk* c) {
   return_chunk_locked(c);
 }
 
+void ChunkManager::return_chunks(Metachunk* first) {
+  MutexLocker fcl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
+  Metachunk* c = first;
+  while (c != NULL) {
+    Metachunk* next = c->next();
+    DEBUG_ONLY(c->set_prev(NULL);)
+    DEBUG_ONLY(c->set_next(NULL);)
+    return_chunk_locked(c);
+    c = next;
+  }
+}
+
 // See return_chunk().
 void ChunkManager::return_chunk_locked(Metachunk* c) {
   assert_lock_strong(Metaspace_lock);
@@ -140,6 +140,11 @@ public:
   //       calling this method.
   void return_chunk(Metachunk* c);
 
+  // Return all chunks of a chain linked via next(), starting at first, as done by a
+  //  dying arena. Same as calling return_chunk() for each, but takes Metaspace_lock
+  //  only once. The chunks may not be accessed anymore after this function returns.
+  void return_chunks(Metachunk* first);
+
   // Given a chunk c, which must be "in use" and must not be a root chunk, attempt to
   // enlarge it in place by claiming its trailing buddy.
   //
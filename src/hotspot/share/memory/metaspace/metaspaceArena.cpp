@@ -141,19 +141,13 @@ MetaspaceArena::~MetaspaceArena() {
   MutexLocker fcl(lock(), Mutex::_no_safepoint_check_flag);
   MemRangeCounter return_counter;
 
-  Metachunk* c = _chunks.first();
-  Metachunk* c2 = NULL;
-
-  while (c) {
-    c2 = c->next();
+  for (Metachunk* c = _chunks.first(); c != NULL; c = c->next()) {
     return_counter.add(c->used_words());
-    DEBUG_ONLY(c->set_prev(NULL);)
-    DEBUG_ONLY(c->set_next(NULL);)
     UL2(debug, "return chunk: " METACHUNK_FORMAT ".", METACHUNK_FORMAT_ARGS(c));
-    _chunk_manager->return_chunk(c);
-    // c may be invalid after return_chunk(c) was called. Don't access anymore.
-    c = c2;
   }
+  // Hand all chunks back in one go, so that purging many small (e.g. hidden class)
+  // arenas does not take Metaspace_lock once per chunk.
+  _chunk_manager->return_chunks(_chunks.first());
 
   UL2(info, "returned %d chunks, total capacity " SIZE_FORMAT " words.",
       return_counter.count(), return_counter.total_size());
@@ -119,4 +119,32 @@ class PaddedPrimitiveArray {
   static T* create(size_t length, void** alloc_base);
 };
 
+// A counter for statistics that are updated concurrently by many threads.
+// Updates go to one of several cells, selected by a hash of the current
+// thread, each on its own cache line, so that they do not all contend on a
+// single word. Reading sums the cells; it is more expensive than an update and,
+// while updates are in flight, only approximate. Access functions are in
+// padded.inline.hpp.
+template <class T, uint stripes = 16, size_t alignment = DEFAULT_CACHE_LINE_SIZE>
+class StripedCounter {
+  struct Cell {
+    volatile T _value;
+  };
+
+  // Keeps the first cell off the cache line of whatever precedes the counter.
+  DEFINE_PAD_MINUS_SIZE(0, alignment, 0);
+  PaddedEnd<Cell, alignment> _cells[stripes];
+
+  inline volatile T* cell_addr();
+
+ public:
+  StripedCounter();
+
+  inline void add(T value);
+  void inc() { add(T(1)); }
+  void dec() { add(T(-1)); }
+
+  inline T sum() const;
+};
+
 #endif // SHARE_MEMORY_PADDED_HPP
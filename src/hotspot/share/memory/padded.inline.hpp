@@ -27,9 +27,12 @@
 
 #include "memory/allocation.inline.hpp"
 #include "memory/padded.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 // Creates an aligned padded array.
 // The memory can't be deleted since the raw memory chunk is not returned.
@@ -97,4 +100,34 @@ T* PaddedPrimitiveArray<T, flags, alignment>::create(size_t length, void** alloc
   return (T*)align_up(chunk, alignment);
 }
 
+template <class T, uint stripes, size_t alignment>
+StripedCounter<T, stripes, alignment>::StripedCounter() {
+  STATIC_ASSERT(is_power_of_2(stripes));
+  for (uint i = 0; i < stripes; i++) {
+    _cells[i]._value = T(0);
+  }
+}
+
+template <class T, uint stripes, size_t alignment>
+inline volatile T* StripedCounter<T, stripes, alignment>::cell_addr() {
+  // Thread objects are large and aligned, so fold in the higher bits.
+  uint h = (uint)((uintptr_t)Thread::current_or_null() >> 4);
+  h ^= (h >> 7) ^ (h >> 13);
+  return &_cells[h & (stripes - 1)]._value;
+}
+
+template <class T, uint stripes, size_t alignment>
+inline void StripedCounter<T, stripes, alignment>::add(T value) {
+  Atomic::add(cell_addr(), value);
+}
+
+template <class T, uint stripes, size_t alignment>
+inline T StripedCounter<T, stripes, alignment>::sum() const {
+  T result = T(0);
+  for (uint i = 0; i < stripes; i++) {
+    result += Atomic::load(&_cells[i]._value);
+  }
+  return result;
+}
+
 #endif // SHARE_MEMORY_PADDED_INLINE_HPP
@@ -427,9 +427,12 @@ void ConstantPool::remove_unshareable_info() {
       // so that the proper class loading and initialization can happen
       // at runtime.
       bool clear_it = true;
-      if (pool_holder()->is_hidden() && index == pool_holder()->this_class_index()) {
+      if (index == pool_holder()->this_class_index()) {
         // All references to a hidden class's own field/methods are through this
         // index. We cannot clear it. See comments in ClassFileParser::fill_instance_klass.
+        // For other classes the entry resolves to the pool holder itself, which is
+        // the same archived class at runtime and needs no loading or access check,
+        // so keeping it saves the resolution of every self reference at startup.
         clear_it = false;
       }
       if (clear_it) {
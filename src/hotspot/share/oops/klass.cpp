@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "jvm_io.h"
 #include "cds/heapShared.hpp"
+#include "classfile/altHashing.hpp"
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/javaClasses.hpp"
@@ -86,6 +87,10 @@ void Klass::set_is_cloneable() {
 void Klass::set_name(Symbol* n) {
   _name = n;
   if (_name != NULL) _name->increment_refcount();
+  // The hash must not depend on addresses, since it is archived with the
+  // class by CDS.
+  _secondary_hash = (_name == NULL) ? 0 :
+    AltHashing::halfsiphash_32(0, (const uint8_t*)_name->bytes(), _name->utf8_length());
 
   if (Arguments::is_dumping_archive() && is_instance_klass()) {
     SystemDictionaryShared::init_dumptime_info(InstanceKlass::cast(this));
@@ -116,6 +121,11 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+  // The table lookup does not update the cache: threads checking different
+  // interfaces against the same class would otherwise keep writing it.
+  if (_secondary_supers_table != NULL) {
+    return lookup_secondary_supers_table(k);
+  }
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
@@ -127,6 +137,47 @@ bool Klass::search_secondary_supers(Klass* k) const {
   return false;
 }
 
+bool Klass::lookup_secondary_supers_table(Klass* k) const {
+  Array<Klass*>* table = _secondary_supers_table;
+  int i = (int)(k->secondary_hash() & (juint)(table->length() / 2 - 1));
+  for (Klass* e = table->at(i); e != NULL; e = table->at(++i)) {
+    if (e == k) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Klass::initialize_secondary_supers_table(TRAPS) {
+  assert(_secondary_supers_table == NULL, "initialize only once");
+  Array<Klass*>* secondaries = secondary_supers();
+  int n = secondaries->length();
+  if (!UseSecondarySupersTable || n < secondary_supers_table_min_length) {
+    return;
+  }
+  // At least twice as many home slots as entries keeps the probe sequences
+  // short. With n overflow slots at most, the last slot always stays empty.
+  int home_slots = round_up_power_of_2(2 * n);
+  Array<Klass*>* table = MetadataFactory::new_array<Klass*>(class_loader_data(), 2 * home_slots, NULL, CHECK);
+  for (int j = 0; j < n; j++) {
+    Klass* k = secondaries->at(j);
+    int i = (int)(k->secondary_hash() & (juint)(home_slots - 1));
+    while (table->at(i) != NULL && table->at(i) != k) {
+      i++;
+    }
+    table->at_put(i, k);
+  }
+  assert(table->at(table->length() - 1) == NULL, "must end with an empty slot");
+  _secondary_supers_table = table;
+}
+
+void Klass::deallocate_secondary_supers_table(ClassLoaderData* loader_data) {
+  if (_secondary_supers_table != NULL) {
+    MetadataFactory::free_array<Klass*>(loader_data, _secondary_supers_table);
+    _secondary_supers_table = NULL;
+  }
+}
+
 // Return self, except for abstract classes with exactly 1
 // implementor.  Then return the 1 concrete implementation.
 Klass *Klass::up_cast_abstract() {
@@ -305,6 +356,7 @@ void Klass::initialize_supers(Klass* k, Array<InstanceKlass*>* transitive_interf
     GrowableArray<Klass*>* secondaries = compute_secondary_supers(extras, transitive_interfaces);
     if (secondaries == NULL) {
       // secondary_supers set by compute_secondary_supers
+      initialize_secondary_supers_table(CHECK);
       return;
     }
 
@@ -349,6 +401,7 @@ void Klass::initialize_supers(Klass* k, Array<InstanceKlass*>* transitive_interf
   #endif
 
     set_secondary_supers(s2);
+    initialize_secondary_supers_table(CHECK);
   }
 }
 
@@ -546,6 +599,9 @@ void Klass::remove_unshareable_info() {
   set_next_sibling(NULL);
   set_next_link(NULL);
 
+  // The table is rebuilt from the archived secondary supers at runtime.
+  _secondary_supers_table = NULL;
+
   // Null out class_loader_data because we don't share that yet.
   set_class_loader_data(NULL);
   set_is_shared();
@@ -581,6 +637,10 @@ void Klass::restore_unshareable_info(ClassLoaderData* loader_data, Handle protec
     loader_data->add_class(this);
   }
 
+  if (_secondary_supers_table == NULL) {
+    initialize_secondary_supers_table(CHECK);
+  }
+
   Handle loader(THREAD, loader_data->class_loader());
   ModuleEntry* module_entry = NULL;
   Klass* k = this;
@@ -136,6 +136,13 @@ class Klass : public Metadata {
   Klass*      _secondary_super_cache;
   // Array of all secondary supertypes
   Array<Klass*>* _secondary_supers;
+  // Open addressing hash table of the secondary supertypes, keyed by their
+  // _secondary_hash, or NULL if the secondaries are few enough to scan.
+  // The first half of the table are the home slots, the second half is
+  // overflow for linear probing, which therefore never wraps around.
+  Array<Klass*>* _secondary_supers_table;
+  // Hash of the class name, to find this class in _secondary_supers_table
+  juint       _secondary_hash;
   // Ordered list of all primary supertypes
   Klass*      _primary_supers[_primary_super_limit];
   // java/lang/Class instance mirroring this class
@@ -227,6 +234,15 @@ protected:
   Array<Klass*>* secondary_supers() const { return _secondary_supers; }
   void set_secondary_supers(Array<Klass*>* k) { _secondary_supers = k; }
 
+  // Below this many secondary supers a linear scan is about as fast as
+  // probing the hash table.
+  static const int secondary_supers_table_min_length = 8;
+
+  Array<Klass*>* secondary_supers_table() const { return _secondary_supers_table; }
+  void initialize_secondary_supers_table(TRAPS);
+  void deallocate_secondary_supers_table(ClassLoaderData* loader_data);
+  juint secondary_hash() const { return _secondary_hash; }
+
   // Return the element of the _super chain of the given depth.
   // If there is no such element, return either NULL or this.
   Klass* primary_super_of_depth(juint i) const {
@@ -359,6 +375,8 @@ protected:
   static ByteSize primary_supers_offset()        { return in_ByteSize(offset_of(Klass, _primary_supers)); }
   static ByteSize secondary_super_cache_offset() { return in_ByteSize(offset_of(Klass, _secondary_super_cache)); }
   static ByteSize secondary_supers_offset()      { return in_ByteSize(offset_of(Klass, _secondary_supers)); }
+  static ByteSize secondary_supers_table_offset() { return in_ByteSize(offset_of(Klass, _secondary_supers_table)); }
+  static ByteSize secondary_hash_offset()        { return in_ByteSize(offset_of(Klass, _secondary_hash)); }
   static ByteSize java_mirror_offset()           { return in_ByteSize(offset_of(Klass, _java_mirror)); }
   static ByteSize class_loader_data_offset()     { return in_ByteSize(offset_of(Klass, _class_loader_data)); }
   static ByteSize modifier_flags_offset()        { return in_ByteSize(offset_of(Klass, _modifier_flags)); }
@@ -478,6 +496,7 @@ protected:
   }
 
   bool search_secondary_supers(Klass* k) const;
+  bool lookup_secondary_supers_table(Klass* k) const;
 
   // Find LCA in class hierarchy
   Klass *LCA( Klass *k );
@@ -528,7 +528,11 @@ void BranchData::print_data_on(outputStream* st, const char* extra) const {
   st->print_cr("taken(%u) displacement(%d)",
                taken(), displacement());
   tab(st);
-  st->print_cr("not taken(%u)", not_taken());
+  if (ProfileBranchFlips) {
+    st->print_cr("not taken(%u) flips(%u)", not_taken(), flips());
+  } else {
+    st->print_cr("not taken(%u)", not_taken());
+  }
 }
 
 // ==================================================================
@@ -1481,7 +1481,12 @@ class BranchData : public JumpData {
 protected:
   enum {
     not_taken_off_set = jump_cell_count,
-    branch_cell_count
+    branch_cell_count,
+    // With ProfileBranchFlips, a trailing cell holds the number of times
+    // the branch changed direction, shifted left by one, with the low bit
+    // recording whether the last execution took the branch.
+    flips_off_set = branch_cell_count,
+    branch_flips_cell_count
   };
 
   void set_displacement(int displacement) {
@@ -1496,7 +1501,7 @@ public:
   virtual bool is_BranchData() const { return true; }
 
   static int static_cell_count() {
-    return branch_cell_count;
+    return ProfileBranchFlips ? branch_flips_cell_count : branch_cell_count;
   }
 
   virtual int cell_count() const {
@@ -1520,12 +1525,24 @@ public:
     return cnt;
   }
 
+  // Number of times the branch changed direction, or 0 if not recorded.
+  uint flips() const {
+    if (!ProfileBranchFlips) {
+      return 0;
+    }
+    return (uint)(intptr_at(flips_off_set) >> 1);
+  }
+
   // Code generation support
   static ByteSize not_taken_offset() {
     return cell_offset(not_taken_off_set);
   }
+  static ByteSize flips_offset() {
+    assert(ProfileBranchFlips, "no flips cell");
+    return cell_offset(flips_off_set);
+  }
   static ByteSize branch_data_size() {
-    return cell_offset(branch_cell_count);
+    return cell_offset(static_cell_count());
   }
 
   // Specific initialization.
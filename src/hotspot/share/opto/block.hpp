@@ -692,6 +692,8 @@ class CFGLoop : public CFGElement {
   GrowableArray<CFGElement*> _members; // list of members of loop
   GrowableArray<BlockProbPair> _exits; // list of successor blocks and their probabilities
   double _exit_prob;       // probability any loop exit is taken on a single loop iteration
+  uint _hoisted_int_values;   // values global code motion hoisted out of the loop, which
+  uint _hoisted_float_values; // stay live across it in int and float registers
   void update_succ_freq(Block* b, double freq);
 
  public:
@@ -702,7 +704,9 @@ class CFGLoop : public CFGElement {
     _parent(NULL),
     _sibling(NULL),
     _child(NULL),
-    _exit_prob(1.0f) {}
+    _exit_prob(1.0f),
+    _hoisted_int_values(0),
+    _hoisted_float_values(0) {}
   CFGLoop* parent() { return _parent; }
   void push_pred(Block* blk, int i, Block_List& worklist, PhaseCFG* cfg);
   void add_member(CFGElement *s) { _members.push(s); }
@@ -725,6 +729,9 @@ class CFGLoop : public CFGElement {
   int id() { return _id; }
   int depth() { return _depth; }
 
+  uint hoisted_values(bool is_float) const { return is_float ? _hoisted_float_values : _hoisted_int_values; }
+  void add_hoisted_value(bool is_float)    { if (is_float) _hoisted_float_values++; else _hoisted_int_values++; }
+
 #ifndef PRODUCT
   void dump( ) const;
   void dump_tree() const;
@@ -644,6 +644,32 @@ WarmCallInfo* InlineTree::ok_to_inline(ciMethod* callee_method, JVMState* jvms,
   return NULL;
 }
 
+//------------------------------should_inline_receiver-------------------------
+bool InlineTree::should_inline_receiver(ciMethod* target, int receiver_count, uint chain_bcs) const {
+  if (target->force_inline() || C->directive()->should_inline(target)) {
+    return true;
+  }
+  int size = target->code_size_for_inlining();
+
+  // Only part of the calls at the site reach this target, so judge
+  // whether it is frequent by its own receiver count.
+  int max_inline_size = C->max_inline_size();
+  int call_site_count = method()->scale_count(receiver_count);
+  int invoke_count    = MAX2(method()->interpreter_invocation_count(), 1);
+  int freq = call_site_count / invoke_count;
+  if ((freq >= InlineFrequencyRatio) ||
+      (call_site_count >= InlineFrequencyCount)) {
+    max_inline_size = C->freq_inline_size();
+  }
+  if (size > max_inline_size) {
+    return false;
+  }
+
+  // Each target in the chain adds a class check and an inlined body, so
+  // keep the whole chain within the budget of a single frequent callee.
+  return chain_bcs + size <= (uint)C->freq_inline_size();
+}
+
 //------------------------------build_inline_tree_for_callee-------------------
 InlineTree *InlineTree::build_inline_tree_for_callee( ciMethod* callee_method, JVMState* caller_jvms, int caller_bci) {
   // Attempt inlining.
@@ -188,6 +188,13 @@
           "Maximum number of unrolls for main loop")                        \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, LockCoarseningLoopChunk, 0, EXPERIMENTAL,                   \
+          "Unroll counted loops that lock a loop invariant object up to "   \
+          "this many times even if their body is large, so that the locks " \
+          "of consecutive iterations are coarsened. The lock is released "  \
+          "at least every that many iterations. 0 disables")                \
+          range(0, max_jint)                                                \
+                                                                            \
   product_pd(bool,  SuperWordLoopUnrollAnalysis,                            \
            "Map number of unrolls for main loop via "                       \
            "Superword Level Parallelism analysis")                          \
@@ -265,15 +272,27 @@
   product(bool, ReduceFieldZeroing, true,                                   \
           "When initializing fields, try to avoid needless zeroing")        \
                                                                             \
+  product(bool, EliminateRedundantStores, false, EXPERIMENTAL,              \
+          "Remove stores of values their memory already holds, also "       \
+          "looking past calls that cannot reach a newly allocated object")  \
+                                                                            \
   product(bool, ReduceInitialCardMarks, true,                               \
           "When initializing fields, try to avoid needless card marks")     \
                                                                             \
   product(bool, ReduceBulkZeroing, true,                                    \
           "When bulk-initializing, try to avoid needless zeroing")          \
                                                                             \
+  product(bool, MergeAdjacentAllocations, false, EXPERIMENTAL,              \
+          "Reserve the TLAB space of an allocation that directly follows "  \
+          "another one with the TLAB bump of the first allocation")         \
+                                                                            \
   product(bool, UseFPUForSpilling, false,                                   \
           "Spill integer registers to FPU instead of stack when possible")  \
                                                                             \
+  product(bool, SplitAroundLoops, false, EXPERIMENTAL,                      \
+          "Keep spilled loop invariant values on the stack across loops "   \
+          "with calls, reloading them at their uses")                       \
+                                                                            \
   develop_pd(intx, RegisterCostAreaRatio,                                   \
           "Spill selection in reg allocator: scale area by (X/64K) before " \
           "adding cost")                                                    \
@@ -313,6 +332,12 @@
   product_pd(bool, OptoRegScheduling,                                       \
           "Instruction Scheduling before register allocation for pressure") \
                                                                             \
+  product(uintx, HoistPressurePercent, 0, EXPERIMENTAL,                     \
+          "With OptoRegScheduling, stop hoisting loop invariant values "    \
+          "out of a loop once they take this percentage of INTPRESSURE "    \
+          "or FLOATPRESSURE. 0 means no limit")                             \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, PartialPeelLoop, true,                                      \
           "Partial peel (rotate) loops")                                    \
                                                                             \
@@ -396,6 +421,14 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false, EXPERIMENTAL,                \
+          "Profiling based inlining for more than two receivers, each "     \
+          "guarded by a receiver class check")                              \
+                                                                            \
+  product(intx, PolymorphicInlineLimit, 4, EXPERIMENTAL,                    \
+          "Maximum number of receivers inlined at a polymorphic call site") \
+          range(2, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -467,6 +500,11 @@
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
                                                                             \
+  product(size_t, CompilationMemoryLimit, 0,                                \
+          "Maximum amount of arena memory in bytes a compilation may use. " \
+          "A compilation that exceeds it is not retried with C2. "          \
+          "0 means no limit")                                               \
+                                                                            \
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
@@ -533,6 +571,11 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  product(bool, PartialEscapeAnalysis, false, EXPERIMENTAL,                 \
+          "Allocate a copy of an object right before the calls it only "    \
+          "escapes through, so that it can be scalar replaced on the "      \
+          "paths that do not reach these calls")                            \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
@@ -629,6 +672,10 @@
   product(bool, TraceSpilling, false, DIAGNOSTIC,                           \
           "Trace spilling")                                                 \
                                                                             \
+  product(bool, PrintOptoRegAllocStats, false, DIAGNOSTIC,                  \
+          "Print the spill code and rematerializations of each "            \
+          "compilation after register allocation")                          \
+                                                                            \
   product(bool, TraceTypeProfile, false, DIAGNOSTIC,                        \
           "Trace type profile")                                             \
                                                                             \
@@ -1358,6 +1358,18 @@ SafePointNode* SafePointNode::next_exception() const {
   }
 }
 
+//----------------------------clone_jvms_with_map------------------------------
+JVMState* SafePointNode::clone_jvms_with_map(Compile* C) const {
+  JVMState* new_jvms = jvms()->clone_shallow(C);
+  uint size = req();
+  SafePointNode* map = new SafePointNode(size, new_jvms);
+  for (uint i = 0; i < size; i++) {
+    map->init_req(i, in(i));
+  }
+  new_jvms->set_map(map);
+  return new_jvms;
+}
+
 
 //------------------------------Ideal------------------------------------------
 // Skip over any collapsed Regions
@@ -1596,6 +1608,7 @@ AllocateNode::AllocateNode(Compile* C, const TypeFunc *atype,
   _is_scalar_replaceable = false;
   _is_non_escaping = false;
   _is_allocation_MemBar_redundant = false;
+  _is_published = false;
   Node *topnode = C->top();
 
   init_req( TypeFunc::Control  , ctrl );
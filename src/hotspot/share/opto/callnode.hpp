@@ -352,6 +352,11 @@ public:
   }
 
   JVMState* jvms() const { return _jvms; }
+
+  // Returns a shallow copy of the JVMState with a new map that has the same
+  // inputs as this node, for use by a GraphKit emitting code at this point.
+  JVMState* clone_jvms_with_map(Compile* C) const;
+
  private:
   void verify_input(JVMState* jvms, uint idx) const {
     assert(verify_jvms(jvms), "jvms must match");
@@ -913,6 +918,8 @@ public:
   bool _is_non_escaping;
   // True when MemBar for new is redundant with MemBar at initialzer exit
   bool _is_allocation_MemBar_redundant;
+  // True once a use that may publish the object has been seen
+  bool _is_published;
 
   virtual uint size_of() const; // Size is bigger
   AllocateNode(Compile* C, const TypeFunc *atype, Node *ctrl, Node *mem, Node *abio,
@@ -379,8 +379,9 @@ public:
 
   float _prob;                  // Probability of true path being taken.
   float _fcnt;                  // Frequency counter
+  float _flip;                  // Fraction of executions that changed direction
   IfNode( Node *control, Node *b, float p, float fcnt )
-    : MultiBranchNode(2), _prob(p), _fcnt(fcnt) {
+    : MultiBranchNode(2), _prob(p), _fcnt(fcnt), _flip(PROB_UNKNOWN) {
     init_class_id(Class_If);
     init_req(0,control);
     init_req(1,b);
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "ci/ciMethod.hpp"
 #include "compiler/compileLog.hpp"
 #include "compiler/oopMap.hpp"
 #include "memory/allocation.inline.hpp"
@@ -204,6 +205,9 @@ PhaseChaitin::PhaseChaitin(uint unique, PhaseCFG &cfg, Matcher &matcher, bool sc
        )
   , _live(0)
   , _lo_degree(0), _lo_stk_degree(0), _hi_degree(0), _simplified(0)
+  , _loop_call_freq(NULL)
+  , _rematerializations(0)
+  , _loop_splits(0)
   , _oldphi(unique)
 #ifndef PRODUCT
   , _trace_spilling(C->directive()->TraceSpillingOption)
@@ -675,12 +679,61 @@ void PhaseChaitin::Register_Allocate() {
     }
   }
 
+  if (PrintOptoRegAllocStats) {
+    print_reg_alloc_stats();
+  }
+
   // Done!
   _live = NULL;
   _ifg = NULL;
   C->set_indexSet_arena(NULL);  // ResourceArea is at end of scope
 }
 
+// Report the spill code of this compilation. Spill copies in loops are also
+// weighted by the frequency of their block, which is what they cost.
+void PhaseChaitin::print_reg_alloc_stats() {
+  uint loads = 0, stores = 0, memoves = 0, copies = 0;
+  uint loop_loads = 0, loop_stores = 0;
+  double load_cost = 0, store_cost = 0;
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* block = _cfg.get_block(i);
+    bool in_loop = block->_loop != NULL && block->_loop->depth() > 0;
+    for (uint j = 1; j < block->number_of_nodes(); j++) {
+      Node* n = block->get_node(j);
+      if (!n->is_MachSpillCopy()) {
+        continue;
+      }
+      bool src_stack = OptoReg::is_stack(get_reg_first(n->in(1)));
+      bool dst_stack = OptoReg::is_stack(get_reg_first(n));
+      if (src_stack && dst_stack) {
+        memoves++;
+      } else if (src_stack) {
+        loads++;
+        load_cost += block->_freq;
+        if (in_loop) loop_loads++;
+      } else if (dst_stack) {
+        stores++;
+        store_cost += block->_freq;
+        if (in_loop) loop_stores++;
+      } else {
+        copies++;
+      }
+    }
+  }
+  ttyLocker ttyl;
+  tty->print("RegAlloc: ");
+  if (C->method() != NULL) {
+    C->method()->print_short_name(tty);
+  } else {
+    tty->print("%s", C->stub_name());
+  }
+  tty->cr();
+  tty->print_cr("  %d trips, %u spill loads (%u in loops, cost %.1f), %u spill stores (%u in loops, cost %.1f)",
+                _trip_cnt + 1, loads, loop_loads, load_cost, stores, loop_stores, store_cost);
+  tty->print_cr("  %u mem-mem moves, %u copies, %u rematerializations, %u live ranges kept on stack in loops",
+                memoves, copies, _rematerializations, _loop_splits);
+}
+
 void PhaseChaitin::de_ssa() {
   // Set initial Names for all Nodes.  Most Nodes get the virtual register
   // number.  A few get the ZERO live range number.  These do not
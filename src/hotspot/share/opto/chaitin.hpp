@@ -473,6 +473,20 @@ class PhaseChaitin : public PhaseRegAlloc {
 
   bool is_high_pressure( Block *b, LRG *lrg, uint insidx );
 
+  // Frequency of the most frequent block with a call, per loop id
+  GrowableArray<double>* _loop_call_freq;
+  void compute_loop_call_freq(Arena* arena);
+  // True if b is in a loop which executes a call about as often as b
+  bool in_loop_with_call(Block* b) const;
+  // True if def is not redefined in the loop of b
+  bool is_loop_invariant_def(Node* def, Block* b);
+
+  // Number of rematerialized defs and of live ranges kept on the stack
+  // across a loop with calls, for PrintOptoRegAllocStats
+  uint _rematerializations;
+  uint _loop_splits;
+  void print_reg_alloc_stats();
+
   uint _oldphi;                 // Node index which separates pre-allocation nodes
 
   Block **_blks;                // Array of blocks sorted by frequency for coalescing
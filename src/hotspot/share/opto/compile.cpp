@@ -521,6 +521,37 @@ void Compile::print_compile_messages() {
 //------------------------------Compile standard-------------------------------
 debug_only( int Compile::_debug_idx = 100000; )
 
+volatile size_t Compile::_peak_arena_memory     = 0;
+volatile uint   Compile::_memory_limit_bailouts = 0;
+
+size_t Compile::arena_memory_in_use() {
+  return _comp_arena.size_in_bytes() +
+         _node_arena.size_in_bytes() +
+         _old_arena.size_in_bytes() +
+         _Compile_types.size_in_bytes() +
+         env()->arena()->size_in_bytes() +
+         Thread::current()->resource_area()->size_in_bytes();
+}
+
+bool Compile::check_memory_limit() {
+  size_t in_use = arena_memory_in_use();
+  size_t peak = Atomic::load(&_peak_arena_memory);
+  while (in_use > peak) {
+    size_t prev = Atomic::cmpxchg(&_peak_arena_memory, peak, in_use);
+    if (prev == peak) {
+      break;
+    }
+    peak = prev;
+  }
+  if (CompilationMemoryLimit > 0 && in_use > CompilationMemoryLimit && !failing()) {
+    // Like running out of nodes, this would happen again on a retry
+    Atomic::inc(&_memory_limit_bailouts);
+    record_method_not_compilable("out of memory");
+    return true;
+  }
+  return failing();
+}
+
 // Compile a method.  entry_bci is -1 for normal compilations and indicates
 // the continuation bci for on stack replacement.
 
@@ -2201,6 +2232,10 @@ void Compile::Optimize() {
 
   // Perform escape analysis
   if (_do_escape_analysis && ConnectionGraph::has_candidates(this)) {
+    if (PartialEscapeAnalysis && EliminateAllocations) {
+      ConnectionGraph::materialize_partial_escapes(this, &igvn);
+      if (failing())  return;
+    }
     if (has_loops()) {
       // Cleanup graph (remove dead nodes).
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
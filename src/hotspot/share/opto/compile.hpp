@@ -40,6 +40,7 @@
 #include "opto/phasetype.hpp"
 #include "opto/phase.hpp"
 #include "opto/regmask.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/timerTrace.hpp"
@@ -326,6 +327,10 @@ class Compile : public Phase {
   static IdealGraphPrinter* _debug_network_printer;
 #endif
 
+  // Arena memory statistics over all compilations
+  static volatile size_t _peak_arena_memory;     // Most arena memory used by a compilation
+  static volatile uint   _memory_limit_bailouts; // Compilations that exceeded CompilationMemoryLimit
+
 
   // Node management
   uint                  _unique;                // Counter for unique Node indices
@@ -752,6 +757,13 @@ class Compile : public Phase {
     }
   }
 
+  // Arena memory used by this compilation, and the check against
+  // CompilationMemoryLimit. It is polled whenever a new phase is created.
+  size_t arena_memory_in_use();
+  bool check_memory_limit();
+  static size_t peak_arena_memory()     { return Atomic::load(&_peak_arena_memory); }
+  static uint   memory_limit_bailouts() { return Atomic::load(&_memory_limit_bailouts); }
+
   // Node management
   uint         unique() const              { return _unique; }
   uint         next_unique()               { return _unique++; }
@@ -867,6 +879,8 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = NULL,
                                    bool allow_intrinsics = true);
+  CallGenerator*    call_generator_for_receivers(ciMethod* call_method, int vtable_index, JVMState* jvms,
+                                                 float profile_factor, ciCallProfile& profile, int morphism);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms) ||
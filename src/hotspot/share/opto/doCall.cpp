@@ -230,6 +230,13 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = NULL;
         }
       }
+      if (receiver_method == NULL && UsePolymorphicInlining && allow_inline &&
+          !have_major_receiver && morphism != 1 && profile.has_receiver(2)) {
+        CallGenerator* cg = call_generator_for_receivers(callee, vtable_index, jvms, prof_factor, profile, morphism);
+        if (cg != NULL) {
+          return cg;
+        }
+      }
       if (receiver_method == NULL &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
@@ -311,35 +318,41 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
     // number of implementors for decl_interface is 0 or 1. If
     // it's 0 then no class implements decl_interface and there's
     // no point in inlining.
+    // A sealed interface with several implementors may still have a single
+    // concrete implementation of the method among them, which is bound the
+    // same way.
     if (call_does_dispatch && bytecode == Bytecodes::_invokeinterface) {
       ciInstanceKlass* declared_interface =
           caller->get_declared_method_holder_at_bci(bci)->as_instance_klass();
       ciInstanceKlass* singleton = declared_interface->unique_implementor();
+      ciMethod* cha_monomorphic_target = NULL;
 
       if (singleton != NULL &&
           (!callee->is_default_method() || callee->is_overpass()) /* CHA doesn't support default methods yet */) {
         assert(singleton != declared_interface, "not a unique implementor");
-
-        ciMethod* cha_monomorphic_target =
+        cha_monomorphic_target =
             callee->find_monomorphic_target(caller->holder(), declared_interface, singleton);
+      } else if (singleton == NULL && declared_interface->nof_implementors() > 1 &&
+                 declared_interface->is_sealed()) {
+        cha_monomorphic_target = callee->find_monomorphic_target_in_sealed(declared_interface);
+      }
 
-        if (cha_monomorphic_target != NULL &&
-            cha_monomorphic_target->holder() != env()->Object_klass()) { // subtype check against Object is useless
-          ciKlass* holder = cha_monomorphic_target->holder();
+      if (cha_monomorphic_target != NULL &&
+          cha_monomorphic_target->holder() != env()->Object_klass()) { // subtype check against Object is useless
+        ciKlass* holder = cha_monomorphic_target->holder();
 
-          // Try to inline the method found by CHA. Inlined method is guarded by the type check.
-          CallGenerator* hit_cg = call_generator(cha_monomorphic_target,
-              vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
+        // Try to inline the method found by CHA. Inlined method is guarded by the type check.
+        CallGenerator* hit_cg = call_generator(cha_monomorphic_target,
+            vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
 
-          // Deoptimize on type check fail. The interpreter will throw ICCE for us.
-          CallGenerator* miss_cg = CallGenerator::for_uncommon_trap(callee,
-              Deoptimization::Reason_class_check, Deoptimization::Action_none);
+        // Deoptimize on type check fail. The interpreter will throw ICCE for us.
+        CallGenerator* miss_cg = CallGenerator::for_uncommon_trap(callee,
+            Deoptimization::Reason_class_check, Deoptimization::Action_none);
 
-          CallGenerator* cg = CallGenerator::for_guarded_call(holder, miss_cg, hit_cg);
-          if (hit_cg != NULL && cg != NULL) {
-            dependencies()->assert_unique_concrete_method(declared_interface, cha_monomorphic_target);
-            return cg;
-          }
+        CallGenerator* cg = CallGenerator::for_guarded_call(holder, miss_cg, hit_cg);
+        if (hit_cg != NULL && cg != NULL) {
+          dependencies()->assert_unique_concrete_method(declared_interface, cha_monomorphic_target);
+          return cg;
         }
       }
     } // call_does_dispatch && bytecode == Bytecodes::_invokeinterface
@@ -372,6 +385,77 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+// Build a chain of receiver class checks for a call site that was profiled
+// with more than two receivers and has no major one. The receivers are
+// checked in profile order, so the most frequent one is tested first, and
+// each hit inlines the target of that receiver. The chain stops at the first
+// receiver whose target is not worth inlining. It falls back to a virtual
+// call, or to an uncommon trap when every receiver seen at the site is in
+// the chain.
+CallGenerator* Compile::call_generator_for_receivers(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                     float prof_factor, ciCallProfile& profile, int morphism) {
+  ciMethod* caller = jvms->method();
+  int       bci    = jvms->bci();
+  InlineTree* ilt = InlineTree::find_subtree_from_root(this->ilt(), jvms->caller(), caller);
+
+  ciMethod*      targets[ciCallProfile::MorphismLimit];
+  CallGenerator* hit_cgs[ciCallProfile::MorphismLimit];
+  int  num_targets = 0;
+  uint chain_bcs   = 0;
+  for (int i = 0; i < PolymorphicInlineLimit && profile.has_receiver(i); i++) {
+    ciMethod* target = callee->resolve_invoke(caller->holder(), profile.receiver(i));
+    if (target == NULL || !ilt->should_inline_receiver(target, profile.receiver_count(i), chain_bcs)) {
+      break;
+    }
+    CallGenerator* hit_cg = call_generator(target, vtable_index, false /* call_does_dispatch */, jvms,
+                                           true /* allow_inline */, prof_factor);
+    if (hit_cg == NULL || !(hit_cg->is_inline() || hit_cg->is_late_inline())) {
+      break;
+    }
+    targets[num_targets] = target;
+    hit_cgs[num_targets] = hit_cg;
+    num_targets++;
+    chain_bcs += target->code_size_for_inlining();
+  }
+  if (num_targets < 2) {
+    // Leave the call site to the other heuristics
+    return NULL;
+  }
+
+  CallGenerator* miss_cg;
+  if (morphism == num_targets &&
+      !too_many_traps_or_recompiles(caller, bci, Deoptimization::Reason_bimorphic)) {
+    miss_cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_bimorphic,
+                                               Deoptimization::Action_maybe_recompile);
+  } else {
+    miss_cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                        : CallGenerator::for_virtual_call(callee, vtable_index));
+  }
+  if (miss_cg == NULL) {
+    return NULL;
+  }
+
+  // Build the chain from its end. The probability of each check is relative
+  // to the calls that were not claimed by the checks before it.
+  int site_count = profile.count();
+  int remaining  = site_count;
+  for (int i = 0; i < num_targets - 1; i++) {
+    remaining -= profile.receiver_count(i);
+  }
+  CallGenerator* cg = miss_cg;
+  for (int i = num_targets - 1; i >= 0; i--) {
+    int receiver_count = profile.receiver_count(i);
+    float hit_prob = MIN2((float)receiver_count / (float)MAX2(remaining, 1), PROB_MAX);
+    trace_type_profile(C, caller, jvms->depth() - 1, bci, targets[i], profile.receiver(i), site_count, receiver_count);
+    // As for bimorphic sites, Parse::Parse() adds the dependencies of the inlined targets.
+    cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cgs[i], hit_prob);
+    if (i > 0) {
+      remaining += profile.receiver_count(i - 1);
+    }
+  }
+  return cg;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
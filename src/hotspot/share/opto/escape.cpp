@@ -36,6 +36,7 @@
 #include "opto/cfgnode.hpp"
 #include "opto/compile.hpp"
 #include "opto/escape.hpp"
+#include "opto/graphKit.hpp"
 #include "opto/phaseX.hpp"
 #include "opto/movenode.hpp"
 #include "opto/rootnode.hpp"
@@ -111,6 +112,328 @@ void ConnectionGraph::do_analysis(Compile *C, PhaseIterGVN *igvn) {
   }
 }
 
+// Partial escape analysis.
+//
+// The connection graph is flow-insensitive: an object which is passed to a
+// call on some path, for example to report an error, escapes on all paths.
+// An allocation whose only escaping uses are arguments of Java calls is
+// materialized instead: right before each such call a copy of the object
+// is allocated, initialized from the fields of the original and passed to
+// the call in its place. The original allocation then no longer escapes and
+// can be scalar replaced by PhaseMacroExpand::eliminate_allocate_node(),
+// while the copy is only allocated on the paths which reach the call.
+//
+// After a call the compiled code may only refer to the copy. This is only
+// done when the original object is not loaded or stored once it was passed
+// to the call, and when all safepoints which are reachable from the call and
+// reference the object are dominated by it.
+
+// Upper bound on the number of control and memory nodes visited per call.
+static const uint PartialEscapeRegionLimit = 1000;
+
+// Collect the control flow reachable from 'call' into 'cone' and mark the
+// nodes which can only be reached through 'call' in 'dominated'.
+static bool compute_region_after_call(Node* call, Node* alloc, Unique_Node_List& cone, VectorSet& dominated) {
+  cone.push(call);
+  for (uint i = 0; i < cone.size(); i++) {
+    Node* n = cone.at(i);
+    for (DUIterator_Fast imax, j = n->fast_outs(imax); j < imax; j++) {
+      Node* use = n->fast_out(j);
+      if (use != n && use->is_CFG() && !use->is_Root()) {
+        cone.push(use);
+      }
+    }
+    if (cone.size() > PartialEscapeRegionLimit) {
+      return false;
+    }
+  }
+  if (cone.member(call->in(0)) || cone.member(alloc)) {
+    // The call or the allocation is in a loop with the call.
+    return false;
+  }
+  for (uint i = 0; i < cone.size(); i++) {
+    dominated.set(cone.at(i)->_idx);
+  }
+  bool progress = true;
+  while (progress) {
+    progress = false;
+    for (uint i = 1; i < cone.size(); i++) {
+      Node* n = cone.at(i);
+      if (!dominated.test(n->_idx)) {
+        continue;
+      }
+      uint first = n->is_Region() ? 1 : 0;
+      uint limit = n->is_Region() ? n->req() : 1;
+      for (uint k = first; k < limit; k++) {
+        Node* pred = n->in(k);
+        if (pred != NULL && !pred->is_top() && !dominated.test(pred->_idx)) {
+          dominated.remove(n->_idx);
+          progress = true;
+          break;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Collect the memory states which are reachable from the memory produced by 'call'.
+static bool compute_memory_after_call(Node* call, Unique_Node_List& mem_cone) {
+  for (DUIterator_Fast imax, i = call->fast_outs(imax); i < imax; i++) {
+    Node* proj = call->fast_out(i);
+    if (proj->is_Proj() && proj->bottom_type() == Type::MEMORY) {
+      mem_cone.push(proj);
+    }
+  }
+  for (uint i = 0; i < mem_cone.size(); i++) {
+    Node* m = mem_cone.at(i);
+    for (DUIterator_Fast jmax, j = m->fast_outs(jmax); j < jmax; j++) {
+      Node* use = m->fast_out(j);
+      if (use->bottom_type() == Type::MEMORY) {
+        mem_cone.push(use);
+      } else if (use->is_Multi() || use->is_LoadStore()) {
+        for (DUIterator_Fast kmax, k = use->fast_outs(kmax); k < kmax; k++) {
+          Node* proj = use->fast_out(k);
+          if (proj->bottom_type() == Type::MEMORY) {
+            mem_cone.push(proj);
+          }
+        }
+      }
+    }
+    if (mem_cone.size() > PartialEscapeRegionLimit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ConnectionGraph::materialize_partial_escapes(Compile* C, PhaseIterGVN* igvn) {
+  Compile::TracePhase tp("partialEscapeAnalysis", &Phase::timers[Phase::_t_escapeAnalysis]);
+  ResourceMark rm;
+
+  GrowableArray<AllocateNode*> allocs;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (n->is_Allocate() && !n->is_AllocateArray()) {
+      allocs.append(n->as_Allocate());
+    }
+  }
+  if (allocs.is_empty()) {
+    return;
+  }
+
+  // Signal GraphKit it's post-parse phase.
+  assert(C->inlining_incrementally() == false, "sanity");
+  C->set_inlining_incrementally(true);
+
+  C->for_igvn()->clear();
+  C->initial_gvn()->replace_with(igvn);
+
+  bool progress = false;
+  for (int i = 0; i < allocs.length() && !C->failing(); i++) {
+    if (materialize_at_escapes(C, allocs.at(i))) {
+      progress = true;
+    }
+  }
+
+  C->set_inlining_incrementally(false);
+
+  if (progress && !C->failing()) {
+    {
+      ResourceMark rm;
+      PhaseRemoveUseless pru(C->initial_gvn(), C->for_igvn());
+      if (C->failing())  return;
+    }
+    *igvn = PhaseIterGVN(C->initial_gvn());
+    igvn->optimize();
+  }
+}
+
+bool ConnectionGraph::materialize_at_escapes(Compile* C, AllocateNode* alloc) {
+  PhaseGVN* gvn = C->initial_gvn();
+  Node* res = alloc->result_cast();
+  if (res == NULL || !res->is_CheckCastPP()) {
+    return false;
+  }
+  const TypeInstPtr* res_type = gvn->type(res)->isa_instptr();
+  if (res_type == NULL || !res_type->klass_is_exact() ||
+      !res_type->klass()->is_instance_klass()) {
+    return false;
+  }
+  ciInstanceKlass* ik = res_type->klass()->as_instance_klass();
+  if (ik->has_finalizer() || ik->nof_nonstatic_fields() > EliminateAllocationFieldsLimit) {
+    return false;
+  }
+
+  // Only field accesses, debug uses and Java call arguments are supported.
+  Unique_Node_List escapes;
+  Unique_Node_List safepoints;
+  Node_List mem_ops;
+  for (DUIterator_Fast imax, i = res->fast_outs(imax); i < imax; i++) {
+    Node* use = res->fast_out(i);
+    if (use->is_AddP()) {
+      const TypeX* offset = gvn->type(use->in(AddPNode::Offset))->isa_intptr_t();
+      if (use->in(AddPNode::Base) != res || use->in(AddPNode::Address) != res ||
+          offset == NULL || !offset->is_con() ||
+          offset->get_con() < instanceOopDesc::base_offset_in_bytes()) {
+        return false;
+      }
+      for (DUIterator_Fast jmax, j = use->fast_outs(jmax); j < jmax; j++) {
+        Node* n = use->fast_out(j);
+        if (!(n->is_Load() || n->is_Store()) || n->in(MemNode::Address) != use ||
+            (n->is_Store() && n->in(MemNode::ValueIn) == res)) {
+          return false;
+        }
+        mem_ops.push(n);
+      }
+    } else if (use->is_SafePoint()) {
+      SafePointNode* sfpt = use->as_SafePoint();
+      if (sfpt->is_Call() && sfpt->as_Call()->has_non_debug_use(res)) {
+        if (!sfpt->is_CallJava() || sfpt->as_CallJava()->method() == NULL ||
+            sfpt->in(0) == NULL || sfpt->in(0)->is_top()) {
+          return false;
+        }
+        escapes.push(sfpt);
+      }
+      safepoints.push(sfpt);
+    } else if (!use->is_MemBar() && use->Opcode() != Op_CastP2X) {
+      // MemBars only have a precedence edge to the object and CastP2X
+      // computes card mark addresses. Everything else may escape.
+      return false;
+    }
+  }
+  if (escapes.size() == 0) {
+    return false;
+  }
+
+  // For each call find the safepoints which must refer to the copy after it.
+  GrowableArray<Node_List*> after_call;
+  VectorSet covered;
+  for (uint i = 0; i < escapes.size(); i++) {
+    Node* call = escapes.at(i);
+    Unique_Node_List cone;
+    VectorSet dominated;
+    Unique_Node_List mem_cone;
+    if (!compute_region_after_call(call, alloc, cone, dominated) ||
+        !compute_memory_after_call(call, mem_cone)) {
+      return false;
+    }
+    for (uint j = 0; j < mem_ops.size(); j++) {
+      if (mem_cone.member(mem_ops.at(j)->in(MemNode::Memory))) {
+        return false; // The object is accessed after it was passed to the call.
+      }
+    }
+    Node_List* sfpts = new Node_List();
+    for (uint j = 0; j < safepoints.size(); j++) {
+      Node* sfpt = safepoints.at(j);
+      if (cone.member(sfpt)) {
+        if (!dominated.test(sfpt->_idx)) {
+          return false; // The safepoint may be reached with and without the call.
+        }
+        sfpts->push(sfpt);
+        if (sfpt != call) {
+          covered.set(sfpt->_idx);
+        }
+      }
+    }
+    after_call.append(sfpts);
+  }
+
+  // Calls which are dominated by another call use the copy made for that call.
+  for (uint i = 0; i < escapes.size(); i++) {
+    CallJavaNode* call = escapes.at(i)->as_CallJava();
+    if (covered.test(call->_idx)) {
+      continue;
+    }
+    Node* copy = materialize_before_call(C, ik, res, call);
+    Node_List* sfpts = after_call.at(i);
+    for (uint j = 0; j < sfpts->size(); j++) {
+      Node* sfpt = sfpts->at(j);
+      if (sfpt != call) {
+        sfpt->replace_edge(res, copy);
+        C->record_for_igvn(sfpt);
+      }
+    }
+#ifndef PRODUCT
+    if (PrintEliminateAllocations) {
+      tty->print("=== Materialized allocation %d before call %d ", alloc->_idx, call->_idx);
+      call->method()->print_short_name(tty);
+      tty->cr();
+    }
+#endif
+  }
+  return true;
+}
+
+static const Type* field_value_type(ciField* field) {
+  BasicType bt = field->layout_type();
+  if (is_reference_type(bt)) {
+    return field->type()->is_loaded() ? TypeOopPtr::make_from_klass(field->type()->as_klass())
+                                      : TypeInstPtr::BOTTOM;
+  }
+  return Type::get_const_basic_type(bt);
+}
+
+// Allocate a copy of 'obj' right before 'call' and pass it to the call
+// instead of 'obj'.
+Node* ConnectionGraph::materialize_before_call(Compile* C, ciInstanceKlass* ik, Node* obj, CallJavaNode* call) {
+  JVMState* jvms = call->clone_jvms_with_map(C);
+  GraphKit kit(jvms);
+
+  // Adjust JVMS from post-call to pre-call state: put args on stack
+  uint nargs = call->method()->arg_size();
+  kit.ensure_stack(kit.sp() + nargs);
+  for (uint i = TypeFunc::Parms; i < call->tf()->domain()->cnt(); i++) {
+    kit.push(call->in(i));
+  }
+  jvms = kit.sync_jvms();
+
+  Node* copy = NULL;
+  {
+    // Deoptimization re-executes the call with the original object,
+    // which is reallocated from the debug information.
+    PreserveReexecuteState preexecs(&kit);
+    kit.jvms()->set_should_reexecute(true);
+
+    int nfields = ik->nof_nonstatic_fields();
+    Node** values = NEW_RESOURCE_ARRAY(Node*, nfields);
+    bool has_final_fields = false;
+    for (int i = 0; i < nfields; i++) {
+      ciField* field = ik->nonstatic_field_at(i);
+      Node* adr = kit.basic_plus_adr(obj, field->offset());
+      values[i] = kit.access_load_at(obj, adr, C->alias_type(field)->adr_type(),
+                                     field_value_type(field), field->layout_type(), IN_HEAP);
+      has_final_fields |= field->is_final();
+    }
+
+    copy = kit.new_instance(kit.makecon(TypeKlassPtr::make(ik)), NULL, NULL, true /* deoptimize_on_exception */);
+
+    // The stores should be captured by the InitializeNode of the copy.
+    for (int i = 0; i < nfields; i++) {
+      ciField* field = ik->nonstatic_field_at(i);
+      Node* adr = kit.basic_plus_adr(copy, field->offset());
+      kit.access_store_at(copy, adr, C->alias_type(field)->adr_type(), values[i],
+                          field_value_type(field), field->layout_type(), IN_HEAP);
+    }
+    if (has_final_fields) {
+      // The copy is published by the call, same as in Parse::do_exits().
+      kit.insert_mem_bar(Op_MemBarRelease, copy);
+    }
+    kit.replace_in_map(obj, copy);
+  }
+
+  kit.dec_sp(nargs);
+  kit.sync_jvms();
+
+  call->set_req(TypeFunc::Control , kit.control());
+  call->set_req(TypeFunc::I_O     , kit.i_o());
+  call->set_req(TypeFunc::Memory  , kit.reset_memory());
+  call->set_req(TypeFunc::FramePtr, kit.frameptr());
+  call->replace_edge(obj, copy);
+  C->record_for_igvn(call);
+  return copy;
+}
+
 bool ConnectionGraph::compute_escape() {
   Compile* C = _compile;
   PhaseGVN* igvn = _igvn;
@@ -110,6 +110,7 @@
 // it could point to is marked ArgEscape.
 //
 
+class  ciInstanceKlass;
 class  Compile;
 class  Node;
 class  CallNode;
@@ -569,6 +570,10 @@ private:
   // Compute the escape information
   bool compute_escape();
 
+  // Partial escape analysis support
+  static bool materialize_at_escapes(Compile* C, AllocateNode* alloc);
+  static Node* materialize_before_call(Compile* C, ciInstanceKlass* ik, Node* obj, CallJavaNode* call);
+
 public:
   ConnectionGraph(Compile *C, PhaseIterGVN *igvn);
 
@@ -578,6 +583,10 @@ public:
   // Perform escape analysis
   static void do_analysis(Compile *C, PhaseIterGVN *igvn);
 
+  // Copy allocations at the calls they only escape through, before
+  // escape analysis, so that the original allocation does not escape.
+  static void materialize_partial_escapes(Compile* C, PhaseIterGVN* igvn);
+
   bool not_global_escape(Node *n);
 
   // To be used by, e.g., BarrierSetC2 impls
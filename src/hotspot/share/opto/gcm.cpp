@@ -1130,6 +1130,7 @@ void PhaseCFG::latency_from_uses(Node *n) {
 Block* PhaseCFG::hoist_to_cheaper_block(Block* LCA, Block* early, Node* self) {
   const double delta = 1+PROB_UNLIKELY_MAG(4);
   Block* least       = LCA;
+  Block* orig_LCA    = LCA;
   double least_freq  = least->_freq;
   uint target        = get_latency_for_node(self);
   uint start_latency = get_latency_for_node(LCA->head());
@@ -1148,6 +1149,27 @@ Block* PhaseCFG::hoist_to_cheaper_block(Block* LCA, Block* early, Node* self) {
   if (mach && mach->out_RegMask().is_bound1() && mach->out_RegMask().is_NotEmpty())
     in_latency = true;
 
+  // A value hoisted out of a loop stays live across the whole loop. Once the
+  // values hoisted out of a loop take their share of the registers, more of
+  // them only get spilled inside the loop, so stop hoisting out of it.
+  // Values that are cheap to rematerialize do not count: the register
+  // allocator recomputes them rather than spilling them.
+  bool limit_pressure = OptoRegScheduling && HoistPressurePercent > 0 &&
+                        mach != NULL && !mach->rematerialize() && self->ideal_reg() != 0;
+  CFGLoop* pressure_loop = NULL; // Innermost loop self may not leave
+  bool is_float = false;
+  if (limit_pressure) {
+    uint ireg = self->ideal_reg();
+    is_float = (ireg == Op_RegF || ireg == Op_RegD || RegMask::is_vector(ireg));
+    uint limit = (uint)((is_float ? FLOATPRESSURE : INTPRESSURE) * HoistPressurePercent / 100);
+    for (CFGLoop* loop = LCA->_loop; loop != NULL && loop != early->_loop; loop = loop->parent()) {
+      if (loop->hoisted_values(is_float) >= limit) {
+        pressure_loop = loop;
+        break;
+      }
+    }
+  }
+
 #ifndef PRODUCT
   if (trace_opto_pipelining()) {
     tty->print("# Find cheaper block for latency %d: ", get_latency_for_node(self));
@@ -1180,6 +1202,10 @@ Block* PhaseCFG::hoist_to_cheaper_block(Block* LCA, Block* early, Node* self) {
     if (mach && LCA == root_block)
       break;
 
+    // Don't hoist out of a loop that is already short of registers
+    if (pressure_loop != NULL && !pressure_loop->in_loop_nest(LCA))
+      break;
+
     if (self->is_memory_writer() &&
         (LCA->_loop->depth() > early->_loop->depth())) {
       // LCA is an invalid placement for a memory writer: choosing it would
@@ -1225,6 +1251,13 @@ Block* PhaseCFG::hoist_to_cheaper_block(Block* LCA, Block* early, Node* self) {
   }
 #endif
 
+  // Account for self in the loops it is hoisted out of
+  if (limit_pressure) {
+    for (CFGLoop* loop = orig_LCA->_loop; !loop->in_loop_nest(least); loop = loop->parent()) {
+      loop->add_hoisted_value(is_float);
+    }
+  }
+
   // See if the latency needs to be updated
   if (target < end_latency) {
 #ifndef PRODUCT
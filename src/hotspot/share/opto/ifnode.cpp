@@ -1708,6 +1708,9 @@ void IfProjNode::related(GrowableArray<Node*> *in_rel, GrowableArray<Node*> *out
 //------------------------------dump_spec--------------------------------------
 void IfNode::dump_spec(outputStream *st) const {
   st->print("P=%f, C=%f",_prob,_fcnt);
+  if (_flip != PROB_UNKNOWN) {
+    st->print(", F=%f", _flip);
+  }
 }
 
 //-------------------------------related---------------------------------------
@@ -939,6 +939,9 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   uint body_size = _body.size();
   // Key test to unroll loop in CRC32 java code
   int xors_in_loop = 0;
+  // Locks on a loop invariant object are coarsened across the iterations
+  // of an unrolled body.
+  int invariant_locks = 0;
   // Also count ModL, DivL and MulL which expand mightly
   for (uint k = 0; k < _body.size(); k++) {
     Node* n = _body.at(k);
@@ -947,6 +950,12 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
       case Op_ModL: body_size += 30; break;
       case Op_DivL: body_size += 30; break;
       case Op_MulL: body_size += 10; break;
+      case Op_Lock: {
+        if (is_invariant(n->as_Lock()->obj_node())) {
+          invariant_locks++;
+        }
+        break;
+      }
       case Op_StrComp:
       case Op_StrEquals:
       case Op_StrIndexOf:
@@ -1004,6 +1013,12 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * LoopUnrollLimit) {
       return phase->may_require_nodes(estimate);
     }
+    if (invariant_locks > 0 && future_unroll_cnt <= LockCoarseningLoopChunk &&
+        body_size < 4u * LoopUnrollLimit) {
+      // Holding the lock over a bounded chunk of iterations saves the
+      // unlock and relock of every other iteration.
+      return phase->may_require_nodes(estimate);
+    }
     return false; // Loop too big.
   }
 
@@ -548,6 +548,158 @@ void PhaseIdealLoop::long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_
   }
 }
 
+// Is exp the long iv times a constant?
+static bool is_scaled_long_iv(Node* exp, Node* iv, jlong* p_scale) {
+  if (exp == iv) {
+    *p_scale = 1;
+    return true;
+  }
+  int opc = exp->Opcode();
+  if (opc == Op_MulL) {
+    if (exp->in(1) == iv && exp->in(2)->is_Con()) {
+      *p_scale = exp->in(2)->get_long();
+      return true;
+    }
+    if (exp->in(2) == iv && exp->in(1)->is_Con()) {
+      *p_scale = exp->in(1)->get_long();
+      return true;
+    }
+  } else if (opc == Op_LShiftL) {
+    if (exp->in(1) == iv && exp->in(2)->is_Con()) {
+      jint shift_amount = exp->in(2)->get_int() & (BitsPerJavaLong - 1);
+      if (shift_amount < BitsPerJavaInteger - 1) {
+        *p_scale = ((jlong)1) << shift_amount;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Is exp the long iv times a constant plus an (optional) offset? Returns
+// a NULL offset if there is none.
+static bool is_scaled_long_iv_plus_offset(Node* exp, Node* iv, jlong* p_scale, Node** p_offset) {
+  if (is_scaled_long_iv(exp, iv, p_scale)) {
+    *p_offset = NULL;
+    return true;
+  }
+  if (exp->Opcode() == Op_AddL) {
+    if (is_scaled_long_iv(exp->in(1), iv, p_scale)) {
+      *p_offset = exp->in(2);
+      return true;
+    }
+    if (is_scaled_long_iv(exp->in(2), iv, p_scale)) {
+      *p_offset = exp->in(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Is n a range check of the form (scale * iv + offset) <u range, with
+// scale and offset usable for an int range check of the inner loop?
+bool PhaseIdealLoop::is_long_range_check(Node* n, IdealLoopTree* loop, Node* iv, jlong* p_scale, Node** p_offset) {
+  if (!n->is_RangeCheck() || !n->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolNode* bol = n->in(1)->as_Bool();
+  if (bol->_test._test != BoolTest::lt || bol->in(1)->Opcode() != Op_CmpUL) {
+    return false;
+  }
+  Node* cmp = bol->in(1);
+  if (!loop->is_invariant(cmp->in(2)) ||
+      !is_scaled_long_iv_plus_offset(cmp->in(1), iv, p_scale, p_offset)) {
+    return false;
+  }
+  jlong scale = *p_scale;
+  return scale != 0 && scale > -max_jint && scale < max_jint &&
+         (*p_offset == NULL || loop->is_invariant(*p_offset));
+}
+
+// Collect the long range checks of the loop that transform_long_range_checks()
+// turns into int range checks, and return the number of iterations of the
+// inner loop for which the scaled inner loop iv of all of them fits in an int.
+int PhaseIdealLoop::extract_long_range_checks(IdealLoopTree* loop, jlong stride_con, int iters_limit,
+                                              PhiNode* phi, Node_List& range_checks) {
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    jlong scale = 0;
+    Node* offset = NULL;
+    if (is_long_range_check(n, loop, phi, &scale, &offset)) {
+      int rc_iters_limit = (max_jint - 1) / (int)ABS(scale);
+      // At least 2 iterations so counted loop construction doesn't fail
+      if (rc_iters_limit / ABS(stride_con) >= 2) {
+        range_checks.push(n);
+        iters_limit = MIN2(iters_limit, rc_iters_limit);
+      }
+    }
+  }
+  return iters_limit;
+}
+
+// Rewrite the long range checks in the body of the inner loop of a long
+// loop nest:
+//
+//   scale * (outer_phi + inner_phi) + offset <u range
+//
+// The scaled inner iv x = scale * inner_phi is in [x_lo, x_hi] with
+// x_hi - x_lo < max_jint (see extract_long_range_checks()). With
+// p = scale * outer_phi + offset, the check passes iff -p <= x < range - p.
+// The outer loop body computes:
+//
+//   L = clamp(-p, x_lo, x_hi + 1)
+//   H = clamp(range - p, x_lo, x_hi + 1)
+//
+// so the check is equivalent to L <= x < H, that is the int range check:
+//
+//   scale * inner_phi - L <u max(H - L, 0)
+//
+// with a loop invariant offset and range that RCE and loop predication
+// handle. If range - p overflows, H is x_lo and the new check always fails,
+// which only causes a deoptimization that the original check would not
+// have caused.
+void PhaseIdealLoop::transform_long_range_checks(int stride_con, const Node_List& range_checks, PhiNode* phi,
+                                                 Node* outer_phi, Node* inner_phi, IdealLoopTree* loop) {
+  for (uint i = 0; i < range_checks.size(); i++) {
+    RangeCheckNode* rc = range_checks.at(i)->as_RangeCheck();
+    Node* range = rc->in(1)->in(1)->in(2);
+    jlong scale = 0;
+    Node* offset = NULL;
+    bool ok = is_long_range_check(rc, loop, phi, &scale, &offset);
+    assert(ok, "inconsistent: was tested before");
+    if (offset == NULL) {
+      offset = _igvn.longcon(0);
+    }
+
+    jlong x_lo = 0;
+    jlong x_hi = max_jint - 1;
+    if ((scale > 0) != (stride_con > 0)) {
+      x_lo = -(max_jint - 1);
+      x_hi = 0;
+    }
+
+    Node* scaled_outer = _igvn.transform(new MulLNode(outer_phi, _igvn.longcon(scale)));
+    Node* p = _igvn.transform(new AddLNode(scaled_outer, offset));
+    // -L = clamp(p, -(x_hi + 1), -x_lo)
+    Node* neg_l = MaxNode::signed_min(p, _igvn.longcon(-x_lo), TypeLong::LONG, _igvn);
+    neg_l = MaxNode::signed_max(neg_l, _igvn.longcon(-(x_hi + 1)), TypeLong::make(-(x_hi + 1), -x_lo, Type::WidenMin), _igvn);
+    Node* l = _igvn.transform(new SubLNode(_igvn.longcon(0), neg_l));
+    Node* h = _igvn.transform(new SubLNode(range, p));
+    h = MaxNode::signed_min(h, _igvn.longcon(x_hi + 1), TypeLong::LONG, _igvn);
+    h = MaxNode::signed_max(h, _igvn.longcon(x_lo), TypeLong::make(x_lo, x_hi + 1, Type::WidenMin), _igvn);
+    Node* new_range = MaxNode::max_diff_with_zero(h, l, TypeLong::make(0, max_jint, Type::WidenMin), _igvn);
+    new_range = _igvn.transform(new ConvL2INode(new_range));
+    Node* new_offset = _igvn.transform(new ConvL2INode(neg_l));
+
+    Node* new_index = _igvn.transform(new MulINode(inner_phi, _igvn.intcon((int)scale)));
+    new_index = _igvn.transform(new AddINode(new_index, new_offset));
+    Node* new_cmp = _igvn.transform(new CmpUNode(new_index, new_range));
+    Node* new_bol = _igvn.transform(new BoolNode(new_cmp, BoolTest::lt));
+    set_subtree_ctrl(new_bol, true);
+    _igvn.replace_input_of(rc, 1, new_bol);
+  }
+}
+
 void PhaseIdealLoop::add_empty_predicate(Deoptimization::DeoptReason reason, Node* inner_head, IdealLoopTree* loop, SafePointNode* sfpt) {
   if (!C->too_many_traps(reason)) {
     Node *cont = _igvn.intcon(1);
@@ -817,6 +969,12 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
   assert(phi_t->_hi >= phi_t->_lo, "dead phi?");
   iters_limit = (int)MIN2((julong)iters_limit, (julong)(phi_t->_hi - phi_t->_lo));
 
+  // Long range checks of the loop iv are turned into int range checks of
+  // the inner loop iv below, which needs the inner loop to be short enough
+  // for the scaled inner loop iv to fit in an int.
+  Node_List range_checks;
+  iters_limit = extract_long_range_checks(loop, stride_con, iters_limit, phi, range_checks);
+
   LongCountedLoopEndNode* exit_test = head->loopexit();
   BoolTest::mask bt = exit_test->test_trip();
 
@@ -913,6 +1071,8 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
     }
   }
 
+  transform_long_range_checks((int)stride_con, range_checks, phi, outer_phi, inner_phi, loop);
+
   // Replace inner loop long iv phi as inner loop int iv phi + outer
   // loop iv phi
   long_loop_replace_long_iv(phi, inner_phi, outer_phi, head);
@@ -4115,6 +4275,16 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
     }
   }
 
+  // Move the reductions introduced by SuperWord out of the vectorized loops.
+  if (UseSuperWord && SuperWordReductions && C->has_loops() && !C->major_progress()) {
+    for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+      IdealLoopTree* lpt = iter.current();
+      if (lpt->is_counted() && lpt->is_innermost()) {
+        move_unordered_reduction_out_of_loop(lpt);
+      }
+    }
+  }
+
   // disable assert until issue with split_flow_path is resolved (6742111)
   // assert(!_has_irreducible_loops || C->parsed_irreducible_loop() || C->is_osr_compilation(),
   //        "shouldn't introduce irreducible loops");
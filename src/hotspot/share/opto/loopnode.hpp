@@ -1172,6 +1172,11 @@ public:
 
   void long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_iv, Node* outer_phi, Node* inner_head);
   bool transform_long_counted_loop(IdealLoopTree* loop, Node_List &old_new);
+  bool is_long_range_check(Node* n, IdealLoopTree* loop, Node* iv, jlong* p_scale, Node** p_offset);
+  int extract_long_range_checks(IdealLoopTree* loop, jlong stride_con, int iters_limit, PhiNode* phi,
+                                Node_List &range_checks);
+  void transform_long_range_checks(int stride_con, const Node_List &range_checks, PhiNode* phi,
+                                   Node* outer_phi, Node* inner_phi, IdealLoopTree* loop);
 #ifdef ASSERT
   bool convert_to_long_loop(Node* cmp, Node* phi, IdealLoopTree* loop);
 #endif
@@ -1343,6 +1348,10 @@ public:
   // Cause the rce'd post loop to optimized away, this happens if we cannot complete multiverioning
   void poison_rce_post_loop(IdealLoopTree *rce_loop);
 
+  // Replace a chain of integral vector reductions on a loop phi by vector
+  // accumulation in the loop and a single reduction after the loop.
+  void move_unordered_reduction_out_of_loop(IdealLoopTree* loop);
+
   // Create a slow version of the loop by cloning the loop
   // and inserting an if to select fast-slow versions.
   ProjNode* create_slow_version_of_loop(IdealLoopTree *loop,
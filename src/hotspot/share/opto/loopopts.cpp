@@ -41,6 +41,7 @@
 #include "opto/rootnode.hpp"
 #include "opto/subnode.hpp"
 #include "opto/subtypenode.hpp"
+#include "opto/vectornode.hpp"
 #include "utilities/macros.hpp"
 
 //=============================================================================
@@ -684,10 +685,13 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Avoid duplicated float compare.
   if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) return NULL;
 
+  // A branch that changes direction on a large fraction of its executions
+  // is likely mispredicted often, which pays for one more speculative op.
+  bool unpredictable = iff->_flip != PROB_UNKNOWN && iff->_flip >= PROB_FAIR / 2;
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
   if (used_inside_loop) {
-    if (cost >= ConditionalMoveLimit) return NULL; // Too much goo
+    if (cost >= ConditionalMoveLimit + (unpredictable ? 1 : 0)) return NULL; // Too much goo
 
     // BlockLayoutByFrequency optimization moves infrequent branch
     // from hot path. No point in CMOV'ing in such case (110 is used
@@ -700,9 +704,16 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // we are going to predict accurately all the time.
   if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
-  } else if (iff->_prob < infrequent_prob ||
-      iff->_prob > (1.0f - infrequent_prob))
-    return NULL;
+  } else {
+    // Without a direction change profile, assume the less likely path is
+    // what gets mispredicted. A branch that goes the same way in long runs
+    // is predicted well even if both directions are common.
+    float mispredict = MIN2(iff->_prob, 1.0f - iff->_prob);
+    if (iff->_flip != PROB_UNKNOWN) {
+      mispredict = MIN2(mispredict, iff->_flip);
+    }
+    if (mispredict < infrequent_prob) return NULL;
+  }
 
   // --------------
   // Now replace all Phis with CMOV's
@@ -3577,3 +3588,171 @@ void PhaseIdealLoop::reorg_offsets(IdealLoopTree *loop) {
   }
 
 }
+
+// Returns the vector opcode that accumulates the lanes of an integral
+// reduction in a vector, or 0 if the reduction can not be reordered.
+static int unordered_reduction_vector_opcode(int ropc, BasicType bt) {
+  if (bt != T_INT && bt != T_LONG) {
+    // Float reductions are strictly ordered, and sub-int element types would
+    // wrap around in the vector lanes.
+    return 0;
+  }
+  switch (ropc) {
+    case Op_AddReductionVI: return bt == T_INT ? Op_AddVI : 0;
+    case Op_AddReductionVL: return bt == T_LONG ? Op_AddVL : 0;
+    case Op_MulReductionVI: return bt == T_INT ? Op_MulVI : 0;
+    case Op_MulReductionVL: return bt == T_LONG ? Op_MulVL : 0;
+    case Op_MinReductionV:  return Op_MinV;
+    case Op_MaxReductionV:  return Op_MaxV;
+    case Op_AndReductionV:  return Op_AndV;
+    case Op_OrReductionV:   return Op_OrV;
+    case Op_XorReductionV:  return Op_XorV;
+    default:                return 0;
+  }
+}
+
+// Returns the scalar opcode of an integral reduction, used to look up the
+// identity element.
+static int unordered_reduction_scalar_opcode(int ropc, BasicType bt) {
+  bool is_int = (bt == T_INT);
+  switch (ropc) {
+    case Op_AddReductionVI: return Op_AddI;
+    case Op_AddReductionVL: return Op_AddL;
+    case Op_MulReductionVI: return Op_MulI;
+    case Op_MulReductionVL: return Op_MulL;
+    case Op_MinReductionV:  return is_int ? Op_MinI : Op_MinL;
+    case Op_MaxReductionV:  return is_int ? Op_MaxI : Op_MaxL;
+    case Op_AndReductionV:  return is_int ? Op_AndI : Op_AndL;
+    case Op_OrReductionV:   return is_int ? Op_OrI : Op_OrL;
+    case Op_XorReductionV:  return is_int ? Op_XorI : Op_XorL;
+    default: ShouldNotReachHere(); return 0;
+  }
+}
+
+// SuperWord reduces every vector of a loop iteration into the scalar loop
+// phi. For reductions whose lanes can be combined in any order, the vectors
+// can be accumulated lane-wise in a vector phi instead, so only one
+// reduction is needed after the loop:
+//
+//   Phi(init, r2)                      Phi(identity vector, a2)
+//   r1 = Reduction(Phi, v1)            a1 = VectorOp(Phi, v1)
+//   r2 = Reduction(r1, v2)     ==>     a2 = VectorOp(a1, v2)
+//   (uses of r2 after the loop)        r = Reduction(init, a2) after the loop
+//
+// This is only done if the phi and the reductions in the chain have no other
+// uses in the loop and all vectors have the same type.
+void PhaseIdealLoop::move_unordered_reduction_out_of_loop(IdealLoopTree* loop) {
+  CountedLoopNode* cl = loop->_head->as_CountedLoop();
+  if (!cl->is_vectorized_loop()) {
+    return;
+  }
+
+  for (DUIterator_Fast jmax, j = cl->fast_outs(jmax); j < jmax; j++) {
+    Node* phi = cl->fast_out(j);
+    if (!phi->is_Phi() || phi->outcnt() != 1 || phi->req() != 3 || phi->in(2) == NULL) {
+      continue;
+    }
+    Node* last_red = phi->in(2);
+    int const ropc = last_red->Opcode();
+    if (last_red->req() != 3 || last_red->in(2) == NULL ||
+        last_red->in(2)->bottom_type()->isa_vect() == NULL) {
+      continue;
+    }
+    const TypeVect* vec_t = last_red->in(2)->bottom_type()->is_vect();
+    BasicType bt = vec_t->element_basic_type();
+    int const vopc = unordered_reduction_vector_opcode(ropc, bt);
+    if (vopc == 0 ||
+        !Matcher::match_rule_supported_vector(vopc, vec_t->length(), bt) ||
+        !Matcher::match_rule_supported_vector(VectorNode::replicate_opcode(bt), vec_t->length(), bt)) {
+      continue;
+    }
+
+    // Walk up the chain of reductions to the phi.
+    Node* current = last_red;
+    Node* first_red = NULL;
+    bool chain_ok = true;
+    while (chain_ok) {
+      Node* vector_input = current->in(2);
+      if (current->in(0) != NULL ||
+          vector_input->bottom_type() != vec_t ||
+          !loop->is_member(get_loop(get_ctrl(vector_input)))) {
+        chain_ok = false;
+        break;
+      }
+      if (current == last_red) {
+        // All uses other than the phi must be outside of the loop.
+        for (DUIterator_Fast kmax, k = current->fast_outs(kmax); k < kmax; k++) {
+          Node* use = current->fast_out(k);
+          if (use != phi && loop->is_member(get_loop(ctrl_or_self(use)))) {
+            chain_ok = false;
+            break;
+          }
+        }
+      } else if (current->outcnt() != 1) {
+        chain_ok = false;
+      }
+      if (!chain_ok) {
+        break;
+      }
+      Node* scalar_input = current->in(1);
+      if (scalar_input == phi) {
+        first_red = current;
+        break;
+      } else if (scalar_input->Opcode() == ropc && scalar_input->req() == 3) {
+        current = scalar_input;
+      } else {
+        // E.g. a partially vectorized loop with a scalar reduction in the chain.
+        chain_ok = false;
+      }
+    }
+    if (!chain_ok) {
+      continue;
+    }
+    assert(first_red != NULL, "chain must end at the phi");
+
+    int const sopc = unordered_reduction_scalar_opcode(ropc, bt);
+    Node* identity_scalar = ReductionNode::make_reduction_input(_igvn, sopc, bt);
+    set_ctrl(identity_scalar, C->root());
+    VectorNode* identity_vector = VectorNode::scalar2vector(identity_scalar, vec_t->length(),
+                                                            Type::get_const_basic_type(bt));
+    register_new_node(identity_vector, C->root());
+    assert(identity_vector->bottom_type() == vec_t, "must match the accumulated vectors");
+
+    // Turn the scalar phi into a vector phi.
+    Node* init = phi->in(1);
+    _igvn.rehash_node_delayed(phi);
+    phi->set_req_X(1, identity_vector, &_igvn);
+    phi->as_Type()->set_type(vec_t);
+    _igvn.set_type(phi, vec_t);
+
+    // Walk down the chain, replacing each reduction by a vector operation.
+    current = first_red;
+    for (;;) {
+      Node* vector_acc = VectorNode::make(vopc, current->in(1), current->in(2), vec_t);
+      register_new_node(vector_acc, cl);
+      bool const is_last = (current == last_red);
+      _igvn.replace_node(current, vector_acc);
+      if (is_last) {
+        break;
+      }
+      current = vector_acc->unique_out();
+    }
+
+    // Reduce the accumulated vector once after the loop.
+    Node* last_acc = phi->in(2);
+    Node* post_loop_red = ReductionNode::make(sopc, NULL, init, last_acc, bt);
+    for (DUIterator i = last_acc->outs(); last_acc->has_out(i); i++) {
+      Node* use = last_acc->out(i);
+      if (use != phi && use != post_loop_red) {
+        assert(!loop->is_member(get_loop(ctrl_or_self(use))), "use must be outside of the loop");
+        _igvn.rehash_node_delayed(use);
+        for (int replaced = use->replace_edge(last_acc, post_loop_red); replaced > 0; replaced--) {
+          --i;
+        }
+      }
+    }
+    register_new_node(post_loop_red, get_late_ctrl(post_loop_red, cl));
+    assert(phi->outcnt() == 1, "the first vector accumulation is the only use of the phi");
+  }
+}
+
@@ -1218,6 +1218,12 @@ void PhaseMacroExpand::expand_allocate_common(
   Node* initial_slow_test = alloc->in(AllocateNode::InitialTest);
   assert(ctrl != NULL, "must have control");
 
+  // Set up by expand_merged_allocations()
+  Node* follower_size = _merged_size;  // This allocation leads a merged pair
+  Node* merged_oop    = _merged_oop;   // This allocation follows a merged pair
+  _merged_size = NULL;
+  _merged_oop  = NULL;
+
   // We need a Region and corresponding Phi's to merge the slow-path and fast-path results.
   // they will not be used if "always_slow" is set
   enum { slow_result_path = 1, fast_result_path = 2 };
@@ -1225,6 +1231,7 @@ void PhaseMacroExpand::expand_allocate_common(
   Node *result_phi_rawmem = NULL;
   Node *result_phi_rawoop = NULL;
   Node *result_phi_i_o = NULL;
+  Node *result_phi_merged_oop = NULL;
 
   // The initial slow comparison is a size check, the comparison
   // we want to do is a BoolTest::gt
@@ -1301,6 +1308,19 @@ void PhaseMacroExpand::expand_allocate_common(
     debug_only(slow_region = NodeSentinel);
   }
 
+  // If the leader of a merged pair got its storage from the TLAB, it also
+  // reserved the storage of this allocation.
+  Node* merged_ctrl = NULL;
+  if (merged_oop != NULL) {
+    assert(expand_fast_path && initial_slow_test == NULL && allocation_has_use, "checked by can_merge_allocation");
+    Node* merged_cmp = transform_later(new CmpPNode(merged_oop, _igvn.makecon(TypeRawPtr::NULL_PTR)));
+    Node* merged_bol = transform_later(new BoolNode(merged_cmp, BoolTest::ne));
+    IfNode* merged_iff = new IfNode(toobig_false, merged_bol, PROB_LIKELY_MAG(4), COUNT_UNKNOWN);
+    transform_later(merged_iff);
+    merged_ctrl  = transform_later(new IfTrueNode(merged_iff));
+    toobig_false = transform_later(new IfFalseNode(merged_iff));
+  }
+
   // If we are here there are several possibilities
   // - expand_fast_path is false - then only a slow path is expanded. That's it.
   // no_initial_check means a constant allocation.
@@ -1335,12 +1355,46 @@ void PhaseMacroExpand::expand_allocate_common(
       Node* needgc_ctrl = NULL;
       result_phi_rawoop = new PhiNode(result_region, TypeRawPtr::BOTTOM);
 
+      // The leader of a merged pair bumps the TLAB top for both allocations
+      Node* tlab_size = size_in_bytes;
+      if (follower_size != NULL) {
+        assert(expand_fast_path && initial_slow_test == NULL, "checked by can_merge_allocation");
+        tlab_size = transform_later(new AddXNode(size_in_bytes, follower_size));
+      }
+
       intx prefetch_lines = length != NULL ? AllocatePrefetchLines : AllocateInstancePrefetchLines;
       BarrierSetC2* bs = BarrierSet::barrier_set()->barrier_set_c2();
-      Node* fast_oop = bs->obj_allocate(this, ctrl, mem, toobig_false, size_in_bytes, i_o, needgc_ctrl,
+      Node* merged_i_o = i_o;
+      Node* fast_oop = bs->obj_allocate(this, ctrl, mem, toobig_false, tlab_size, i_o, needgc_ctrl,
                                         fast_oop_ctrl, fast_oop_rawmem,
                                         prefetch_lines);
 
+      if (follower_size != NULL) {
+        // The follower's storage starts where this object ends
+        result_phi_merged_oop = new PhiNode(result_region, TypeRawPtr::BOTTOM);
+        result_phi_merged_oop->init_req(fast_result_path, basic_plus_adr(top(), fast_oop, size_in_bytes));
+      }
+      if (merged_oop != NULL) {
+        // Initialize the storage reserved by the leader like storage
+        // taken from the TLAB here
+        RegionNode* merged_region = new RegionNode(3);
+        Node* phi_oop    = new PhiNode(merged_region, TypeRawPtr::BOTTOM);
+        Node* phi_rawmem = new PhiNode(merged_region, Type::MEMORY, TypeRawPtr::BOTTOM);
+        Node* phi_i_o    = new PhiNode(merged_region, Type::ABIO);
+        merged_region->init_req(1, fast_oop_ctrl);
+        phi_oop      ->init_req(1, fast_oop);
+        phi_rawmem   ->init_req(1, fast_oop_rawmem);
+        phi_i_o      ->init_req(1, i_o);
+        merged_region->init_req(2, merged_ctrl);
+        phi_oop      ->init_req(2, merged_oop);
+        phi_rawmem   ->init_req(2, mem);
+        phi_i_o      ->init_req(2, merged_i_o);
+        fast_oop_ctrl   = transform_later(merged_region);
+        fast_oop        = transform_later(phi_oop);
+        fast_oop_rawmem = transform_later(phi_rawmem);
+        i_o             = transform_later(phi_i_o);
+      }
+
       if (initial_slow_test != NULL) {
         // This completes all paths into the slow merge point
         slow_region->init_req(need_gc_path, needgc_ctrl);
@@ -1495,6 +1549,11 @@ void PhaseMacroExpand::expand_allocate_common(
   result_phi_rawmem->init_req(slow_result_path, _callprojs.fallthrough_memproj);
   transform_later(result_phi_rawmem);
   transform_later(result_phi_i_o);
+  if (result_phi_merged_oop != NULL) {
+    // Nothing was reserved for the follower on the slow path
+    result_phi_merged_oop->init_req(slow_result_path, _igvn.makecon(TypeRawPtr::NULL_PTR));
+    _merged_oop = transform_later(result_phi_merged_oop);
+  }
   // This completes all paths into the result merge point
 }
 
@@ -1896,6 +1955,71 @@ void PhaseMacroExpand::expand_allocate_array(AllocateArrayNode *alloc) {
                          slow_call_address);
 }
 
+//-------------------can_merge_allocation----------------------------------
+// An allocation can be merged with another one if it is always expanded
+// with a fast path and no initial test, and its size is a constant.
+bool PhaseMacroExpand::can_merge_allocation(AllocateNode* alloc) {
+  return alloc->result_cast() != NULL &&
+         _igvn.find_int_con(alloc->in(AllocateNode::InitialTest), -1) == 0 &&
+         _igvn.find_intptr_t_con(alloc->in(AllocateNode::AllocSize), -1) > 0;
+}
+
+//-------------------allocation_to_merge_with------------------------------
+// Find an allocation that alloc directly follows: there is no safepoint
+// and no branch between the two, only the exception check of the first
+// allocation and memory barriers. The TLAB space of alloc can then be
+// taken together with the space of the first allocation.
+AllocateNode* PhaseMacroExpand::allocation_to_merge_with(AllocateNode* alloc) {
+  if (!MergeAdjacentAllocations || !UseTLAB || C->env()->dtrace_alloc_probes() ||
+      !can_merge_allocation(alloc)) {
+    return NULL;
+  }
+  Node* ctrl = alloc->in(TypeFunc::Control);
+  for (int i = 0; i < 10; i++) {
+    if (ctrl == NULL || !ctrl->is_Proj()) {
+      return NULL;
+    }
+    Node* n = ctrl->in(0);
+    if (n->is_Allocate()) {
+      AllocateNode* leader = n->as_Allocate();
+      return can_merge_allocation(leader) ? leader : NULL;
+    } else if (n->is_Catch()) {
+      if (ctrl->as_CatchProj()->_con != CatchProjNode::fall_through_index) {
+        return NULL;
+      }
+    } else if (!n->is_MemBar()) {
+      return NULL;
+    }
+    ctrl = n->in(0);
+  }
+  return NULL;
+}
+
+//-------------------expand_merged_allocations-----------------------------
+// The leader takes the TLAB space of both allocations with a single bump
+// of the TLAB top. If it has to go to the runtime instead, it reserves
+// nothing and the follower allocates on its own.
+void PhaseMacroExpand::expand_merged_allocations(AllocateNode* leader, AllocateNode* follower) {
+#ifndef PRODUCT
+  if (PrintEliminateAllocations) {
+    tty->print_cr("Merged allocations %d and %d", leader->_idx, follower->_idx);
+  }
+#endif
+  _merged_size = follower->in(AllocateNode::AllocSize);
+  if (leader->is_AllocateArray()) {
+    expand_allocate_array(leader->as_AllocateArray());
+  } else {
+    expand_allocate(leader);
+  }
+  assert(_merged_size == NULL, "consumed by the leader");
+  if (follower->is_AllocateArray()) {
+    expand_allocate_array(follower->as_AllocateArray());
+  } else {
+    expand_allocate(follower);
+  }
+  assert(_merged_oop == NULL, "consumed by the follower");
+}
+
 //-------------------mark_eliminated_box----------------------------------
 //
 // During EA obj may point to several objects but after few ideal graph
@@ -2512,6 +2636,11 @@ void PhaseMacroExpand::eliminate_macro_nodes() {
       mark_eliminated_locking_nodes(n->as_AbstractLock());
     }
   }
+#ifndef PRODUCT
+  int coarsened = 0;
+  int nested = 0;
+  int non_escaping = 0;
+#endif
   bool progress = true;
   while (progress) {
     progress = false;
@@ -2520,12 +2649,30 @@ void PhaseMacroExpand::eliminate_macro_nodes() {
       bool success = false;
       DEBUG_ONLY(int old_macro_count = C->macro_count();)
       if (n->is_AbstractLock()) {
-        success = eliminate_locking_node(n->as_AbstractLock());
+        AbstractLockNode* alock = n->as_AbstractLock();
+#ifndef PRODUCT
+        int* counter = alock->is_coarsened() ? &coarsened :
+                       alock->is_nested()    ? &nested    : &non_escaping;
+#endif
+        success = eliminate_locking_node(alock);
+        NOT_PRODUCT(if (success) (*counter)++;)
       }
       assert(success == (C->macro_count() < old_macro_count), "elimination reduces macro count");
       progress = progress || success;
     }
   }
+#ifndef PRODUCT
+  if (PrintEliminateLocks && coarsened + nested + non_escaping > 0) {
+    int remaining = 0;
+    for (int i = 0; i < C->macro_count(); i++) {
+      if (C->macro_node(i)->is_AbstractLock()) {
+        remaining++;
+      }
+    }
+    tty->print_cr("++++ Eliminated locks and unlocks in compile %d: %d coarsened, %d nested, %d non-escaping, %d remaining",
+                  C->compile_id(), coarsened, nested, non_escaping, remaining);
+  }
+#endif
   // Next, attempt to eliminate allocations
   _has_locks = false;
   progress = true;
@@ -2717,15 +2864,23 @@ bool PhaseMacroExpand::expand_macro_nodes() {
     if (C->check_node_count(300, "out of nodes before macro expansion")) {
       return true;
     }
-    switch (n->class_id()) {
-    case Node::Class_Allocate:
-      expand_allocate(n->as_Allocate());
-      break;
-    case Node::Class_AllocateArray:
-      expand_allocate_array(n->as_AllocateArray());
-      break;
-    default:
-      assert(false, "unknown node type in macro list");
+    AllocateNode* leader = n->is_Allocate() ? allocation_to_merge_with(n->as_Allocate()) : NULL;
+    if (leader != NULL) {
+      if (C->check_node_count(600, "out of nodes before macro expansion")) {
+        return true;
+      }
+      expand_merged_allocations(leader, n->as_Allocate());
+    } else {
+      switch (n->class_id()) {
+      case Node::Class_Allocate:
+        expand_allocate(n->as_Allocate());
+        break;
+      case Node::Class_AllocateArray:
+        expand_allocate_array(n->as_AllocateArray());
+        break;
+      default:
+        assert(false, "unknown node type in macro list");
+      }
     }
     assert(C->macro_count() < macro_count, "must have deleted a node from macro list");
     if (C->failing())  return true;
@@ -87,12 +87,20 @@ private:
   // Additional data collected during macro expansion
   bool _has_locks;
 
+  // Passed from the expansion of an allocation to the expansion of the
+  // allocation merged with it, see expand_merged_allocations()
+  Node* _merged_size;  // Size of the follower, reserved by the leader
+  Node* _merged_oop;   // Storage reserved for the follower, or NULL
+
   void expand_allocate(AllocateNode *alloc);
   void expand_allocate_array(AllocateArrayNode *alloc);
   void expand_allocate_common(AllocateNode* alloc,
                               Node* length,
                               const TypeFunc* slow_call_type,
                               address slow_call_address);
+  bool can_merge_allocation(AllocateNode* alloc);
+  AllocateNode* allocation_to_merge_with(AllocateNode* alloc);
+  void expand_merged_allocations(AllocateNode* leader, AllocateNode* follower);
   void yank_initalize_node(InitializeNode* node);
   void yank_alloc_node(AllocateNode* alloc);
   Node *value_from_mem(Node *mem, Node *ctl, BasicType ft, const Type *ftype, const TypeOopPtr *adr_t, AllocateNode *alloc);
@@ -201,7 +209,8 @@ private:
   Node* make_arraycopy_load(ArrayCopyNode* ac, intptr_t offset, Node* ctl, Node* mem, BasicType ft, const Type *ftype, AllocateNode *alloc);
 
 public:
-  PhaseMacroExpand(PhaseIterGVN &igvn) : Phase(Macro_Expand), _igvn(igvn), _has_locks(false) {
+  PhaseMacroExpand(PhaseIterGVN &igvn) : Phase(Macro_Expand), _igvn(igvn), _has_locks(false),
+    _merged_size(NULL), _merged_oop(NULL) {
     _igvn.set_delay_transform(true);
   }
   void eliminate_macro_nodes();
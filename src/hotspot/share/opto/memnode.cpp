@@ -624,6 +624,58 @@ ArrayCopyNode* MemNode::find_array_copy_clone(PhaseTransform* phase, Node* ld_al
   return NULL;
 }
 
+// Returns true if the object allocated by 'alloc' cannot be reached by any
+// call: nothing stores the object, passes it to a call or merges it in a
+// Phi. Uses of the object in JVM states do not count: if the frame is
+// deoptimized at a call, the interpreter sees the same memory. A publishing
+// use that merely comes after the call is not good enough, since in a loop
+// it may publish the object of one iteration to the call of the next, so
+// any publishing use rejects. Once an allocation is known to be published
+// that is recorded in the node, so the walk is not repeated for every call
+// that find_previous_store() steps over.
+static bool is_unescaped_at_call(AllocateNode* alloc) {
+  if (alloc->_is_published) {
+    return false;
+  }
+  Node* obj = alloc->result_cast();
+  if (obj == NULL) {
+    return false;
+  }
+  ResourceMark rm;
+  Unique_Node_List worklist;
+  worklist.push(obj);
+  for (uint next = 0; next < worklist.size(); next++) {
+    Node* n = worklist.at(next);
+    for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+      Node* use = n->fast_out(i);
+      if (use->is_AddP() || use->is_ConstraintCast() || use->Opcode() == Op_EncodeP) {
+        worklist.push(use);
+        continue;
+      }
+      if (use->is_Load() || use->is_Cmp() ||
+          (use->is_Store() && use->in(MemNode::ValueIn) != n)) {
+        continue;  // accesses the object, does not publish it
+      }
+      if (use->is_SafePoint()) {
+        bool is_argument = false;
+        if (use->is_Call()) {
+          uint args_end = use->as_Call()->tf()->domain()->cnt();
+          for (uint j = TypeFunc::Parms; j < args_end; j++) {
+            is_argument |= (use->in(j) == n);
+          }
+        }
+        if (!is_argument) {
+          continue;  // only used by the JVM state
+        }
+      }
+      // Anything else may publish the object.
+      alloc->_is_published = true;
+      return false;
+    }
+  }
+  return true;
+}
+
 // The logic for reordering loads and stores uses four steps:
 // (a) Walk carefully past stores and initializations which we
 //     can prove are independent of this load.
@@ -652,6 +704,9 @@ Node* MemNode::find_previous_store(PhaseTransform* phase) {
 
   intptr_t size_in_bytes = memory_size();
 
+  const bool is_unordered_access = is_Load()  ? as_Load()->is_unordered() :
+                                   is_Store() ? as_Store()->is_unordered() : false;
+
   Node* mem = in(MemNode::Memory);   // start searching here...
 
   int cnt = 50;             // Cycle limiter
@@ -744,6 +799,16 @@ Node* MemNode::find_previous_store(PhaseTransform* phase) {
       }
       // Found an arraycopy that may affect that load
       return mem;
+    } else if (EliminateRedundantStores && alloc != NULL && is_unordered_access &&
+               mem->is_Proj() && mem->in(0)->is_Call() && !mem->in(0)->is_ArrayCopy() &&
+               !phase->C->env()->should_retain_local_variables() &&
+               is_unescaped_at_call(alloc)) {
+      // The call cannot see the newly allocated object, let alone modify it.
+      mem = mem->in(0)->in(TypeFunc::Memory);
+      if (mem->is_MergeMem()) {
+        mem = mem->as_MergeMem()->memory_at(phase->C->get_alias_index(adr_type()));
+      }
+      continue;             // (a) advance through independent call memory
     } else if (addr_t != NULL && addr_t->is_known_instance_field()) {
       // Can't use optimize_simple_memory_chain() since it needs PhaseGVN.
       if (mem->is_Proj() && mem->in(0)->is_Call()) {
@@ -2799,6 +2864,17 @@ Node* StoreNode::Identity(PhaseGVN* phase) {
     }
   }
 
+  // Store of the value the memory already holds, possibly from before
+  // a call that cannot reach a newly allocated object?
+  if (result == this && EliminateRedundantStores && is_unordered() &&
+      !phase->type(val)->is_zero_type()) {
+    Node* prev_mem = find_previous_store(phase);
+    if (prev_mem != NULL && prev_mem->is_Store() &&
+        can_see_stored_value(prev_mem, phase) == val) {
+      result = mem;
+    }
+  }
+
   PhaseIterGVN* igvn = phase->is_IterGVN();
   if (result != this && igvn != NULL) {
     MemBarNode* trailing = trailing_membar();
@@ -114,6 +114,12 @@ public:
   // The call_method is an optimized virtual method candidate otherwise.
   WarmCallInfo* ok_to_inline(ciMethod *call_method, JVMState* caller_jvms, ciCallProfile& profile, WarmCallInfo* wci, bool& should_delay);
 
+  // See if it is worth adding the target of one more profiled receiver to
+  // the chain of inlined targets at a polymorphic call site. The receiver
+  // count stands in for the call site count, and chain_bcs is the size of
+  // the targets already in the chain.
+  bool        should_inline_receiver(ciMethod* target, int receiver_count, uint chain_bcs) const;
+
   // Information about inlined method
   JVMState*   caller_jvms()       const { return _caller_jvms; }
   ciMethod   *method()            const { return _method; }
@@ -532,6 +538,7 @@ class Parse : public GraphKit {
   void do_ret();
 
   float   dynamic_branch_prediction(float &cnt, BoolTest::mask btest, Node* test);
+  float   dynamic_branch_flips();
   float   branch_prediction(float &cnt, BoolTest::mask btest, int target_bci, Node* test);
   bool    seems_never_taken(float prob) const;
   bool    path_is_suitable_for_uncommon_trap(float prob) const;
@@ -1342,6 +1342,30 @@ float Parse::dynamic_branch_prediction(float &cnt, BoolTest::mask btest, Node* t
   return prob;
 }
 
+//-----------------------------dynamic_branch_flips----------------------------
+// Return the fraction of executions of the current branch that went the other
+// way than the execution before, or PROB_UNKNOWN if that was not profiled.
+float Parse::dynamic_branch_flips() {
+  if (!ProfileBranchFlips) {
+    return PROB_UNKNOWN;
+  }
+  ciMethodData* methodData = method()->method_data();
+  if (!methodData->is_mature())  return PROB_UNKNOWN;
+  ciProfileData* data = methodData->bci_to_data(bci());
+  if (data == NULL || !data->is_BranchData()) {
+    return PROB_UNKNOWN;
+  }
+  BranchData* branch = data->as_BranchData();
+  uint flips = branch->flips();
+  float sum = (float)branch->taken() + (float)branch->not_taken();
+  // Some platforms do not record flips: a branch that went both ways has
+  // flipped at least once.
+  if (flips == 0 || sum < 40) {
+    return PROB_UNKNOWN;
+  }
+  return MIN2((float)flips / sum, 1.0f);
+}
+
 //-----------------------------branch_prediction-------------------------------
 float Parse::branch_prediction(float& cnt,
                                BoolTest::mask btest,
@@ -1463,6 +1487,7 @@ void Parse::do_ifnull(BoolTest::mask btest, Node *c) {
  // Need xform to put node in hash table
   IfNode *iff = create_and_xform_if( control(), tst, prob, cnt );
   assert(iff->_prob > 0.0f,"Optimizer made bad probability in parser");
+  iff->_flip = dynamic_branch_flips();
   // True branch
   { PreserveJVMState pjvms(this);
     Node* iftrue  = _gvn.transform( new IfTrueNode (iff) );
@@ -1569,6 +1594,7 @@ void Parse::do_if(BoolTest::mask btest, Node* c) {
   float true_prob = (taken_if_true ? prob : untaken_prob);
   IfNode* iff = create_and_map_if(control(), tst, true_prob, cnt);
   assert(iff->_prob > 0.0f,"Optimizer made bad probability in parser");
+  iff->_flip = dynamic_branch_flips();
   Node* taken_branch   = new IfTrueNode(iff);
   Node* untaken_branch = new IfFalseNode(iff);
   if (!taken_if_true) {  // Finish conversion to canonical form
@@ -45,6 +45,11 @@ Phase::Phase( PhaseNumber pnum ) : _pnum(pnum), C( pnum == Compiler ? NULL : Com
   // This is an effective place to poll, since the compiler is full of phases.
   // In particular, every inlining site uses a recursively created Parse phase.
   CompileBroker::maybe_block();
+  // For the same reason it is also a good place to check the memory
+  // used by the compilation.
+  if (C != NULL) {
+    C->check_memory_limit();
+  }
 }
 
 void Phase::print_timers() {
@@ -188,4 +193,8 @@ void Phase::print_timers() {
       tty->print_cr("       Other:               %7.3f s", other);
     }
 
+  tty->print_cr ("    C2 Peak Arena Memory: %7.3f MB", (double)Compile::peak_arena_memory() / M);
+  if (CompilationMemoryLimit > 0) {
+    tty->print_cr ("    C2 Out of Memory Bailouts: %u", Compile::memory_limit_bailouts());
+  }
 }
@@ -407,6 +407,7 @@ Node *PhaseChaitin::split_Rematerialize(Node *def, Block *b, uint insidx, uint &
     set_was_spilled(spill);
 
   insert_proj( b, insidx, spill, maxlrg++ );
+  _rematerializations++;
 #ifdef ASSERT
   // Increment the counter for this lrg
   splits.at_put(slidx, splits.at(slidx)+1);
@@ -483,6 +484,53 @@ bool PhaseChaitin::prompt_use( Block *b, uint lidx ) {
   return false;
 }
 
+//------------------------------compute_loop_call_freq-------------------------
+// Calls kill all registers, so a live range which is live across a loop with
+// a call is on the stack at each iteration. Record for each loop how often
+// its most frequent call executes.
+void PhaseChaitin::compute_loop_call_freq(Arena* arena) {
+  _loop_call_freq = new (arena) GrowableArray<double>(arena, 8, 0, 0.0);
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* b = _cfg.get_block(i);
+    bool has_call = false;
+    for (uint j = 1; j <= b->end_idx(); j++) {
+      if (b->get_node(j)->is_MachCall()) {
+        has_call = true;
+        break;
+      }
+    }
+    if (!has_call) {
+      continue;
+    }
+    for (CFGLoop* lp = b->_loop; lp != NULL && lp->depth() > 0; lp = lp->parent()) {
+      double freq = MAX2(_loop_call_freq->at_grow(lp->id(), 0.0), b->_freq);
+      _loop_call_freq->at_put(lp->id(), freq);
+    }
+  }
+}
+
+//------------------------------in_loop_with_call------------------------------
+bool PhaseChaitin::in_loop_with_call(Block* b) const {
+  CFGLoop* lp = b->_loop;
+  if (lp == NULL || lp->depth() == 0 || lp->id() >= _loop_call_freq->length()) {
+    return false;
+  }
+  // Calls on a cold path of the loop do not pay for the extra reloads.
+  return _loop_call_freq->at(lp->id()) >= b->_freq * 0.5;
+}
+
+//------------------------------is_loop_invariant_def--------------------------
+// The def reaches b unchanged at each iteration of the loop of b: it is
+// defined outside of the loop or is the phi which the loop merges it with.
+bool PhaseChaitin::is_loop_invariant_def(Node* def, Block* b) {
+  Block* def_block = _cfg.get_block_for_node(def);
+  CFGLoop* lp = b->_loop;
+  if (def_block->_loop == NULL || !lp->in_loop_nest(def_block)) {
+    return true;
+  }
+  return def->is_Phi() && def_block == lp->head();
+}
+
 //------------------------------Split--------------------------------------
 //----------Split Routine----------
 // ***** NEW SPLITTING HEURISTIC *****
@@ -571,6 +619,10 @@ uint PhaseChaitin::Split(uint maxlrg, ResourceArea* split_arena) {
   for( slidx = 0; slidx < spill_cnt; slidx++ )
     UP_entry[slidx] = new VectorSet(split_arena);
 
+  if (SplitAroundLoops) {
+    compute_loop_call_freq(split_arena);
+  }
+
   //----------PASS 1----------
   //----------Propagation & Node Insertion Code----------
   // Walk the Blocks in RPO for DEF & USE info
@@ -709,6 +761,14 @@ uint PhaseChaitin::Split(uint maxlrg, ResourceArea* split_arena) {
         // assume Phi is DOWN
         if( is_high_pressure( b, &lrgs(lidx), b->end_idx()) && !prompt_use(b,lidx) )
           UPblock[slidx] = false;
+        // A loop phi is live across the calls of its loop: leave it on the
+        // stack, so that it is stored once before the loop rather than at
+        // each call, and reload it at its uses.
+        if (SplitAroundLoops && UPblock[slidx] && b->head()->is_Loop() &&
+            in_loop_with_call(b) && !prompt_use(b, lidx)) {
+          UPblock[slidx] = false;
+          _loop_splits++;
+        }
         // If we are not split up/down and all inputs are down, then we
         // are down
         if( !needs_split && !u3 )
@@ -1148,7 +1208,12 @@ uint PhaseChaitin::Split(uint maxlrg, ResourceArea* split_arena) {
 
               }
               else {       // DOWN, Split-UP and check register pressure
-                if( is_high_pressure( b, &lrgs(useidx), insidx ) ) {
+                // In a loop with calls, a loop invariant value which is
+                // lifted into a register would be stored again at the next
+                // call: split only at the use, as in high pressure regions.
+                if( is_high_pressure( b, &lrgs(useidx), insidx ) ||
+                    (SplitAroundLoops && in_loop_with_call(b) &&
+                     is_loop_invariant_def(def, b)) ) {
                   // COPY UP HERE - NO DEF - CISC SPILL
                   int delta = split_USE(MachSpillCopyNode::MemToReg, def,b,n,inpidx,maxlrg,true,true, splits,slidx);
                   // If it wasn't split bail
@@ -36,6 +36,7 @@
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -268,8 +269,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  adjust_and_clean_metadata(current);
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -3783,6 +3783,58 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
   }
 }
 
+class KlassCollector : public KlassClosure {
+  GrowableArray<Klass*>* _klasses;
+ public:
+  KlassCollector(GrowableArray<Klass*>* klasses) : _klasses(klasses) {}
+  void do_klass(Klass* k) { _klasses->append(k); }
+};
+
+// The classes are adjusted independently of each other, so the workers
+// claim them in chunks from a snapshot of all loaded classes.
+class VM_RedefineClasses::AdjustAndCleanMetadataTask : public AbstractGangTask {
+  static const int ChunkSize = 64;
+
+  GrowableArray<Klass*>* _klasses;
+  volatile int _claimed;
+
+ public:
+  AdjustAndCleanMetadataTask(GrowableArray<Klass*>* klasses) :
+    AbstractGangTask("Adjust And Clean Metadata"),
+    _klasses(klasses),
+    _claimed(0) {}
+
+  void work(uint worker_id) {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(Thread::current());
+    int length = _klasses->length();
+    for (int start = Atomic::fetch_and_add(&_claimed, ChunkSize);
+         start < length;
+         start = Atomic::fetch_and_add(&_claimed, ChunkSize)) {
+      int end = MIN2(start + ChunkSize, length);
+      for (int i = start; i < end; i++) {
+        adjust_and_clean_metadata.do_klass(_klasses->at(i));
+      }
+    }
+  }
+};
+
+void VM_RedefineClasses::adjust_and_clean_metadata(Thread* current) {
+  WorkGang* workers = Universe::heap()->safepoint_workers();
+  if (workers == NULL || workers->active_workers() <= 1) {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+    return;
+  }
+
+  ResourceMark rm(current);
+  GrowableArray<Klass*> klasses;
+  KlassCollector collector(&klasses);
+  ClassLoaderDataGraph::classes_do(&collector);
+
+  AdjustAndCleanMetadataTask task(&klasses);
+  workers->run_task(&task);
+}
+
 void VM_RedefineClasses::update_jmethod_ids() {
   for (int j = 0; j < _matching_methods_length; ++j) {
     Method* old_method = _matching_old_methods[j];
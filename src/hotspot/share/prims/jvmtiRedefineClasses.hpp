@@ -522,6 +522,11 @@ class VM_RedefineClasses: public VM_Operation {
     void do_klass(Klass* k);
   };
 
+  // Applies AdjustAndCleanMetadata to all loaded classes using the
+  // safepoint workers of the GC, if any.
+  class AdjustAndCleanMetadataTask;
+  void adjust_and_clean_metadata(Thread* current);
+
  public:
   VM_RedefineClasses(jint class_count,
                      const jvmtiClassDefinition *class_defs,
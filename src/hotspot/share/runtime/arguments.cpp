@@ -2747,6 +2747,9 @@ jint Arguments::parse_each_vm_init_arg(const JavaVMInitArgs* args, bool* patch_m
       } else if (strcmp(tail, ":disable") == 0) {
         LogConfiguration::disable_logging();
         ret = true;
+      } else if (strcmp(tail, ":async") == 0) {
+        LogConfiguration::set_async_mode(true);
+        ret = true;
       } else if (*tail == '\0') {
         ret = LogConfiguration::parse_command_line_arguments();
         assert(ret, "-Xlog without arguments should never fail to parse");
@@ -3119,6 +3122,20 @@ jint Arguments::finalize_vm_init_args(bool patch_mod_javabase) {
     }
   }
 
+  if (AutoArchiveClassesFile != NULL) {
+    if (ArchiveClassesAtExit != NULL) {
+      log_info(cds)("AutoArchiveClassesFile could not be set with -XX:ArchiveClassesAtExit.");
+      return JNI_ERR;
+    }
+    // The background dump goes through the same path as jcmd VM.cds dynamic_dump.
+    // It is skipped at runtime if the archive from an earlier run could be mapped.
+    FLAG_SET_ERGO(RecordDynamicDumpInfo, true);
+    struct stat st;
+    if (FLAG_IS_DEFAULT(SharedArchiveFile) && os::stat(AutoArchiveClassesFile, &st) == 0) {
+      FLAG_SET_ERGO(SharedArchiveFile, AutoArchiveClassesFile);
+    }
+  }
+
   // RecordDynamicDumpInfo is not compatible with ArchiveClassesAtExit
   if (ArchiveClassesAtExit != NULL && RecordDynamicDumpInfo) {
     log_info(cds)("RecordDynamicDumpInfo is for jcmd only, could not set with -XX:ArchiveClassesAtExit.");
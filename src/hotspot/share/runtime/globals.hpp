@@ -170,6 +170,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(uint, HandshakeTimeout, 0, DIAGNOSTIC,                            \
           "If nonzero set a timeout in milliseconds for handshakes")        \
                                                                             \
+  product(uint, HandshakeParallelThreshold, 0, EXPERIMENTAL,                \
+          "If nonzero, handshakes with at least this many target threads "  \
+          "let the heap's safepoint workers help the VM thread process "    \
+          "the operations of blocked threads")                              \
+                                                                            \
   product(bool, AlwaysSafeConstructors, false, EXPERIMENTAL,                \
           "Force safe construction, as if all fields are final.")           \
                                                                             \
@@ -290,6 +295,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseInlineCaches, true,                                      \
           "Use Inline Caches for virtual calls ")                           \
                                                                             \
+  product(size_t, InlineCacheBufferSize, 10*K, DIAGNOSTIC,                  \
+          "Size of the buffer for inline cache transition stubs. A full "   \
+          "buffer forces an ICBufferFull safepoint to free the stubs")      \
+          range(1*K, 4*M)                                                   \
+                                                                            \
   product(bool, InlineArrayCopy, true, DIAGNOSTIC,                          \
           "Inline arraycopy native that is known to be part of "            \
           "base library DLL")                                               \
@@ -547,6 +557,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uint, NMTDetailSamplingInterval, 1, DIAGNOSTIC,                   \
+          "In detail mode, capture the call stack of only every Nth "       \
+          "malloc; the other allocations are recorded without a stack")     \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -949,6 +964,13 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(uintx, CompilerThreadCPUPercentage, 0, EXPERIMENTAL,              \
+          "Limit the compiler threads started by "                          \
+          "UseDynamicNumberOfCompilerThreads to this percentage of the "    \
+          "active processors, which reflect container CPU quotas. "         \
+          "0 means no limit")                                               \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
@@ -994,6 +1016,13 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, UseCHA, true,                                               \
           "Enable CHA")                                                     \
                                                                             \
+  product(bool, UseSealedInterfaceCHA, false, EXPERIMENTAL,                 \
+          "Enable CHA for sealed interfaces with several implementors")     \
+                                                                            \
+  product(bool, UseSecondarySupersTable, false, EXPERIMENTAL,               \
+          "Look up secondary supertypes of classes with many of them in a " \
+          "hash table instead of scanning and caching")                     \
+                                                                            \
   product(bool, UseTypeProfile, true,                                       \
           "Check interpreter profile for historically monomorphic calls")   \
                                                                             \
@@ -1079,6 +1108,12 @@ const intx ObjectAlignmentInBytes = 8;
           "If LogVMOutput or LogCompilation is on, save VM output to "      \
           "this file [default: ./hotspot_pid%p.log] (%p replaced with pid)")\
                                                                             \
+  product(size_t, AsyncLogBufferSize, 2*M,                                  \
+          "Memory budget (in bytes) for the buffer of asynchronous "        \
+          "logging; messages are dropped when it is exhausted "             \
+          "(-Xlog:async)")                                                  \
+          range(100*K, 50*M)                                                \
+                                                                            \
   product(ccstr, ErrorFile, NULL,                                           \
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
@@ -1186,6 +1221,11 @@ const intx ObjectAlignmentInBytes = 8;
   product_pd(bool, RewriteFrequentPairs,                                    \
           "Rewrite frequently used bytecode pairs into a single bytecode")  \
                                                                             \
+  product(int, InterpreterOopMapCacheSize, 32, DIAGNOSTIC,                  \
+          "Number of entries in the per-class cache of oop maps for "       \
+          "interpreted frames used during GC stack walks")                  \
+          range(8, 4096)                                                    \
+                                                                            \
   product(bool, PrintInterpreter, false, DIAGNOSTIC,                        \
           "Print the generated interpreter code")                           \
                                                                             \
@@ -1256,6 +1296,11 @@ const intx ObjectAlignmentInBytes = 8;
   develop_pd(bool, ProfileTraps,                                            \
           "Profile deoptimization traps at the bytecode level")             \
                                                                             \
+  product(bool, ProfileBranchFlips, false, EXPERIMENTAL,                    \
+          "Profile how often two-way branches change direction, so that "   \
+          "the JIT can tell unpredictable branches from skewed ones. "      \
+          "Only recorded by the x86 interpreter and C1")                    \
+                                                                            \
   product(intx, ProfileMaturityPercentage, 20,                              \
           "number of method invocations/branches (expressed as % of "       \
           "CompileThreshold) before using the method's profile")            \
@@ -1617,6 +1662,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Minimum number of segments in a code cache block")               \
           range(1, 100)                                                     \
                                                                             \
+  product(bool, CodeCacheAddressOrderedFit, false, EXPERIMENTAL,            \
+          "Allocate code blobs from the lowest free block that fits "       \
+          "instead of the best fitting one, which keeps live code dense "   \
+          "at the start of each code heap")                                 \
+                                                                            \
   notproduct(bool, ExitOnFullCodeCache, false,                              \
           "Exit the VM if we fill the code cache")                          \
                                                                             \
@@ -1798,6 +1848,13 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, PerfDisableSharedMem, false,                                \
           "Store performance data in standard memory")                      \
                                                                             \
+  product(intx, PerfDataPublishInterval, 0, EXPERIMENTAL,                   \
+          "Keep performance data in standard memory and copy it to the "    \
+          "shared memory file at most this often (in milliseconds, "        \
+          "sampled at PerfDataSamplingInterval). 0 updates the shared "     \
+          "memory in place")                                                \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, PerfDataMemorySize, 32*K,                                   \
           "Size of performance data memory region. Will be rounded "        \
           "up to a multiple of the native os page size.")                   \
@@ -1967,6 +2024,16 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, ArchiveClassesAtExit, NULL,                                \
           "The path and name of the dynamic archive file")                  \
                                                                             \
+  product(ccstr, AutoArchiveClassesFile, NULL, EXPERIMENTAL,                \
+          "Dynamic archive mapped on launch if it exists and is valid; "    \
+          "otherwise written by the ServiceThread, as a safepoint VM "      \
+          "operation that blocks it, once class loading has settled")       \
+                                                                            \
+  product(uintx, AutoArchiveClassesSettleTime, 10, EXPERIMENTAL,            \
+          "Seconds without new classes being loaded before "                \
+          "AutoArchiveClassesFile is written")                              \
+          range(1, 3600)                                                    \
+                                                                            \
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
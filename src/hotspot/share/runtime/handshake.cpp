@@ -24,9 +24,12 @@
 
 #include "precompiled.hpp"
 #include "jvm_io.h"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -149,8 +152,8 @@ class HandshakeSpinYield : public StackObj {
     _spin_time_ns = _spin_time_ns > max_spin_time_ns ? max_spin_time_ns : _spin_time_ns;
   }
 
-  void add_result(HandshakeState::ProcessResult pr) {
-    _result_count[current_result_pos()][pr]++;
+  void add_result(HandshakeState::ProcessResult pr, int count = 1) {
+    _result_count[current_result_pos()][pr] += count;
   }
 
   void process() {
@@ -227,6 +230,39 @@ static void log_handshake_info(jlong start_time_ns, const char* name, int target
   }
 }
 
+// Processes the operation for blocked threads of the ThreadsList in
+// parallel. Workers claim the threads in chunks.
+class HandshakeProcessBlockedTask : public AbstractGangTask {
+  static const uint _chunk_size = 16;
+
+  HandshakeOperation* const _op;
+  ThreadsList* const        _list;
+  volatile uint             _claimed;
+  volatile int              _result_count[HandshakeState::_number_states];
+
+ public:
+  HandshakeProcessBlockedTask(HandshakeOperation* op, ThreadsList* list) :
+    AbstractGangTask("Handshake Process Blocked Threads"),
+    _op(op), _list(list), _claimed(0), _result_count() {}
+
+  void work(uint worker_id) {
+    const uint length = _list->length();
+    for (uint start = Atomic::fetch_and_add(&_claimed, _chunk_size);
+         start < length;
+         start = Atomic::fetch_and_add(&_claimed, _chunk_size)) {
+      const uint end = MIN2(start + _chunk_size, length);
+      for (uint i = start; i < end; i++) {
+        HandshakeState::ProcessResult pr = _list->thread_at(i)->handshake_state()->try_process(_op);
+        Atomic::inc(&_result_count[pr]);
+      }
+    }
+  }
+
+  int result_count(HandshakeState::ProcessResult pr) const {
+    return Atomic::load(&_result_count[pr]);
+  }
+};
+
 class VM_HandshakeAllThreads: public VM_Operation {
   HandshakeOperation* const _op;
  public:
@@ -251,7 +287,14 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // _op was created with a count == 1 so don't double count.
     _op->add_target_count(number_of_threads_issued - 1);
 
-    log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread");
+    // With many targets, have the safepoint workers help with the blocked threads.
+    WorkGang* workers = NULL;
+    if (HandshakeParallelThreshold > 0 && (uint)number_of_threads_issued >= HandshakeParallelThreshold) {
+      workers = Universe::heap()->safepoint_workers();
+    }
+
+    log_trace(handshake)("Threads signaled, begin processing blocked threads by VMThread%s",
+                         workers != NULL ? " and workers" : "");
     HandshakeSpinYield hsy(start_time_ns);
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
@@ -263,14 +306,24 @@ class VM_HandshakeAllThreads: public VM_Operation {
       // Have VM thread perform the handshake operation for blocked threads.
       // Observing a blocked state may of course be transient but the processing is guarded
       // by mutexes and we optimistically begin by working on the blocked threads
-      jtiwh.rewind();
-      for (JavaThread* thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
-        // A new thread on the ThreadsList will not have an operation,
-        // hence it is skipped in handshake_try_process.
-        HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
-        hsy.add_result(pr);
-        if (pr == HandshakeState::_succeeded) {
-          emitted_handshakes_executed++;
+      if (workers != NULL) {
+        HandshakeProcessBlockedTask task(_op, jtiwh.list());
+        workers->run_task(&task, workers->active_workers(), true /* add_foreground_work */);
+        for (int i = 0; i < HandshakeState::_number_states; i++) {
+          hsy.add_result((HandshakeState::ProcessResult)i,
+                         task.result_count((HandshakeState::ProcessResult)i));
+        }
+        emitted_handshakes_executed += task.result_count(HandshakeState::_succeeded);
+      } else {
+        jtiwh.rewind();
+        for (JavaThread* thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
+          // A new thread on the ThreadsList will not have an operation,
+          // hence it is skipped in handshake_try_process.
+          HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
+          hsy.add_result(pr);
+          if (pr == HandshakeState::_succeeded) {
+            emitted_handshakes_executed++;
+          }
         }
       }
       hsy.process();
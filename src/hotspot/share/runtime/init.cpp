@@ -82,6 +82,7 @@ void vmStructs_init() NOT_DEBUG_RETURN;
 void vtableStubs_init();
 void InlineCacheBuffer_init();
 void compilerOracle_init();
+void hotMethodList_init();
 bool compileBroker_init();
 void dependencyContext_init();
 void dependencies_init();
@@ -141,6 +142,7 @@ jint init_globals() {
   vtableStubs_init();
   InlineCacheBuffer_init();
   compilerOracle_init();
+  hotMethodList_init();
   dependencyContext_init();
   dependencies_init();
 
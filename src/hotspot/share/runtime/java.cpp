@@ -33,6 +33,7 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/hotMethodList.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -482,6 +483,10 @@ void before_exit(JavaThread* thread) {
     BytecodeHistogram::print();
   }
 
+  if (DumpHotMethodList != NULL) {
+    HotMethodList::dump(DumpHotMethodList);
+  }
+
 #ifdef LINUX
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
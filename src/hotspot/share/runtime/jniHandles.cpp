@@ -82,6 +82,58 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+oop* JNIHandleCache::allocate(OopStorage* storage) {
+  if (_count == 0) {
+    _count = storage->allocate(_entries, ARRAY_SIZE(_entries));
+    if (_count == 0) {
+      return NULL;
+    }
+  }
+  return _entries[--_count];
+}
+
+void JNIHandleCache::release(OopStorage* storage) {
+  if (_count > 0) {
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
+// Java threads allocate global handles through a lazily created cache,
+// other threads go to the storage directly.
+static oop* allocate_handle(OopStorage* storage, bool weak) {
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return storage->allocate();
+  }
+  JavaThread* jt = thread->as_Java_thread();
+  JNIHandleCache* cache = weak ? jt->weak_global_handle_cache() : jt->global_handle_cache();
+  if (cache == NULL) {
+    cache = new JNIHandleCache();
+    if (weak) {
+      jt->set_weak_global_handle_cache(cache);
+    } else {
+      jt->set_global_handle_cache(cache);
+    }
+  }
+  return cache->allocate(storage);
+}
+
+void JNIHandles::release_handle_caches(JavaThread* thread) {
+  JNIHandleCache* cache = thread->global_handle_cache();
+  if (cache != NULL) {
+    thread->set_global_handle_cache(NULL);
+    cache->release(global_handles());
+    delete cache;
+  }
+  cache = thread->weak_global_handle_cache();
+  if (cache != NULL) {
+    thread->set_weak_global_handle_cache(NULL);
+    cache->release(weak_global_handles());
+    delete cache;
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +141,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_handle(global_handles(), false /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -110,7 +162,7 @@ jobject JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_handle(weak_global_handles(), true /* weak */);
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
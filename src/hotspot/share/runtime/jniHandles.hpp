@@ -25,6 +25,7 @@
 #ifndef SHARE_RUNTIME_JNIHANDLES_HPP
 #define SHARE_RUNTIME_JNIHANDLES_HPP
 
+#include "gc/shared/oopStorage.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/handles.hpp"
 
@@ -99,6 +100,9 @@ class JNIHandles : AllStatic {
   static void destroy_weak_global(jobject handle);
   static bool is_global_weak_cleared(jweak handle); // Test jweak without resolution
 
+  // Release the global and weak global entries cached by thread
+  static void release_handle_caches(JavaThread* thread);
+
   // Debugging
   static void print_on(outputStream* st);
   static void print();
@@ -132,6 +136,24 @@ class JNIHandles : AllStatic {
 
 
 
+// Per-thread cache of entries bulk allocated from a global or weak global
+// handle storage, so creating a handle only takes the storage's allocation
+// mutex once per refill.  Cached entries are allocated but hold NULL, like
+// an entry that is in the middle of being created or released, which
+// iteration over the storage already tolerates.
+class JNIHandleCache : public CHeapObj<mtInternal> {
+  oop*   _entries[OopStorage::bulk_allocate_limit];
+  size_t _count;
+
+ public:
+  JNIHandleCache() : _count(0) {}
+
+  // Returns NULL if the storage can't provide an entry.
+  oop* allocate(OopStorage* storage);
+  // Returns the remaining cached entries to storage.
+  void release(OopStorage* storage);
+};
+
 // JNI handle blocks holding local/global JNI handles
 
 class JNIHandleBlock : public CHeapObj<mtInternal> {
@@ -1876,6 +1876,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinAcquisitions, inc());
       return 1;
     }
     SpinPause();
@@ -1966,6 +1967,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinAcquisitions, inc());
         return 1;
       }
 
@@ -1997,14 +1999,13 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
   }
 
   // Spin failed with prejudice -- reduce _SpinDuration.
-  // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-  // AIMD is globally stable.
+  // Successful spins grow _SpinDuration additively, failures shrink it
+  // multiplicatively (AIMD), which is globally stable and backs off
+  // quickly when the owner keeps the lock for long or gets descheduled.
   {
     int x = _SpinDuration;
     if (x > 0) {
-      // Consider an AIMD scheme like: x -= (x >> 3) + 100
-      // This is globally sample and tends to damp the response.
-      x -= Knob_Penalty;
+      x -= (x >> 3) + Knob_Penalty;
       if (x < 0) x = 0;
       _SpinDuration = x;
     }
@@ -2018,8 +2019,12 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(current) > 0) return 1;
+    if (TryLock(current) > 0) {
+      OM_PERFDATA_OP(SpinAcquisitions, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2165,6 +2170,8 @@ PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinAcquisitions            = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinFailures                = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
 
 // One-shot global initialization for the sync subsystem.
@@ -2200,6 +2207,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinAcquisitions);
+    NEWPERFCOUNTER(_sync_SpinFailures);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
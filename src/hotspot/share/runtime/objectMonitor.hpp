@@ -199,6 +199,8 @@ class ObjectMonitor : public CHeapObj<mtInternal> {
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
+  static PerfCounter * _sync_SpinAcquisitions;
+  static PerfCounter * _sync_SpinFailures;
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_SpinLimit;
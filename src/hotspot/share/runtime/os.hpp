@@ -439,6 +439,7 @@ class os: AllStatic {
     java_thread,       // Java, CodeCacheSweeper, JVMTIAgent and Service threads.
     compiler_thread,
     watcher_thread,
+    asynclog_thread,   // dedicated to flushing logs
     os_thread
   };
 
@@ -852,6 +853,11 @@ class os: AllStatic {
   // System loadavg support.  Returns -1 if load average cannot be obtained.
   static int loadavg(double loadavg[], int nelem);
 
+  // System memory pressure support. Stores the percentage of the recent
+  // past (about 10 seconds) in which some tasks were stalled on memory.
+  // Returns -1 if memory pressure cannot be obtained.
+  static int memory_pressure(double* pressure);
+
   // Amount beyond the callee frame size that we bang the stack.
   static int extra_bang_size_in_bytes();
 
@@ -31,6 +31,7 @@
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/perfMemory.hpp"
@@ -54,6 +55,8 @@ size_t                   PerfMemory::_capacity = 0;
 int                      PerfMemory::_initialized = false;
 PerfDataPrologue*        PerfMemory::_prologue = NULL;
 bool                     PerfMemory::_destroyed = false;
+char*                    PerfMemory::_published = NULL;
+jlong                    PerfMemory::_last_publish_ns = 0;
 
 void perfMemory_init() {
 
@@ -240,6 +243,28 @@ void PerfMemory::mark_updated() {
   _prologue->mod_time_stamp = os::elapsed_counter();
 }
 
+void PerfMemory::publish() {
+  if (_published == NULL || !is_usable()) return;
+
+  jlong now = os::javaTimeNanos();
+  if (now - _last_publish_ns < PerfDataPublishInterval * NANOSECS_PER_MILLISEC) return;
+  _last_publish_ns = now;
+
+  // Holding the allocation lock keeps used() and the entry count in the
+  // prologue consistent with the entries copied. Entries are counted when
+  // they are allocated, before they are filled in, so an entry being created
+  // is copied as a reader of the live region could see it, and is complete
+  // in the next snapshot.
+  MutexLocker ml(PerfDataMemAlloc_lock);
+
+  // Copy the entries first and the prologue last, so that a reader seeing
+  // the new used size and entry count also sees the entries they cover.
+  size_t prologue_size = sizeof(PerfDataPrologue);
+  memcpy(_published + prologue_size, _start + prologue_size, used() - prologue_size);
+  OrderAccess::release();
+  memcpy(_published, _start, prologue_size);
+}
+
 // Returns the complete path including the file name of performance data file.
 // Caller is expected to release the allocated memory.
 char* PerfMemory::get_perfdata_file_path() {
@@ -123,6 +123,10 @@ class PerfMemory : AllStatic {
     static PerfDataPrologue*  _prologue;
     static int    _initialized;
     static bool   _destroyed;
+    // Shared memory region snapshots are copied to if PerfDataPublishInterval
+    // is set; the counters themselves then live in standard memory at _start.
+    static char*  _published;
+    static jlong  _last_publish_ns;
 
     static void create_memory_region(size_t sizep);
     static void delete_memory_region();
@@ -145,6 +149,8 @@ class PerfMemory : AllStatic {
       return ((_start != NULL) && (addr >= _start) && (addr < _end));
     }
     static void mark_updated();
+    // Copies the region to the shared memory, if due.
+    static void publish();
 
     // methods for attaching to and detaching from the PerfData
     // memory segment of another JVM process on the same system.
@@ -40,6 +40,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -69,6 +70,7 @@
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/ticks.hpp"
 
 static void post_safepoint_begin_event(EventSafepointBegin& event,
                                        uint64_t safepoint_id,
@@ -103,6 +105,19 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
   }
 }
 
+static void post_safepoint_late_thread_event(const Ticks& start,
+                                             uint64_t safepoint_id,
+                                             JavaThread* thread) {
+  EventSafepointLateThread event(UNTIMED);
+  if (event.should_commit()) {
+    event.set_starttime(start);
+    event.set_endtime(Ticks::now());
+    event.set_safepointId(safepoint_id);
+    event.set_thread(JFR_THREAD_ID(thread));
+    event.commit();
+  }
+}
+
 static void post_safepoint_cleanup_task_event(EventSafepointCleanupTask& event,
                                               uint64_t safepoint_id,
                                               const char* name) {
@@ -244,6 +259,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
+  const Ticks start_ticks = Ticks::now();
 
   do {
     // Check if this has taken too long:
@@ -257,6 +273,8 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        // The safepoint id is only advanced once all threads are safe.
+        post_safepoint_late_thread_event(start_ticks, _safepoint_id + 1, cur_tss->thread());
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -34,6 +34,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "runtime/perfMemory.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/vm_version.hpp"
 
@@ -171,6 +172,8 @@ void StatSampler::collect_sample() {
   assert(_sampled != NULL, "list not initialized");
 
   sample_data(_sampled);
+
+  PerfMemory::publish();
 }
 
 /*
@@ -1534,6 +1534,14 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
     _no_progress_cnt++;
   }
 
+  if (current->is_Java_thread() && deflated_count >= (size_t)MonitorDeflationMax) {
+    // This cycle stopped at the per-cycle limit so there are likely more
+    // idle ObjectMonitors. Run the next cycle right away rather than
+    // waiting out AsyncDeflationInterval, so a large backlog after a lock
+    // storm drains in back-to-back batches of MonitorDeflationMax.
+    set_is_async_deflation_requested(true);
+  }
+
   return deflated_count;
 }
 
@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "cds/dynamicArchive.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
@@ -51,6 +52,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -1087,6 +1089,8 @@ JavaThread::JavaThread() :
 
   _jni_active_critical(0),
   _pending_jni_exception_check_fn(nullptr),
+  _global_handle_cache(nullptr),
+  _weak_global_handle_cache(nullptr),
   _depth_first_number(0),
 
   // JVMTI PopFrame support
@@ -1101,6 +1105,8 @@ JavaThread::JavaThread() :
   _jvmti_thread_state(nullptr),
   _interp_only_mode(0),
   _should_post_on_exceptions_flag(JNI_FALSE),
+  _profile_sample_countdown(0),
+  _profile_sample_seed(os::random() | 1),
   _thread_stat(new ThreadStatistics()),
 
   _parker(),
@@ -1258,6 +1264,9 @@ JavaThread::~JavaThread() {
     set_deferred_updates(NULL);
   }
 
+  // Return the handle entries cached after exit() released the caches
+  JNIHandles::release_handle_caches(this);
+
   // All Java related clean up happens in exit
   ThreadSafepointState::destroy(this);
   if (_thread_stat != NULL) delete _thread_stat;
@@ -1497,6 +1506,8 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_handle_caches(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1556,6 +1567,8 @@ void JavaThread::cleanup_failed_attach_current_thread(bool is_daemon) {
     JNIHandleBlock::release_block(block);
   }
 
+  JNIHandles::release_handle_caches(this);
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -2870,6 +2883,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // real raw monitor. VM is setup enough here for raw monitor enter.
   JvmtiExport::transition_pending_onload_raw_monitors();
 
+  // Start the writer thread for -Xlog:async. Messages logged so far have
+  // been written synchronously.
+  AsyncLogWriter::initialize();
+
   // Create the VMThread
   { TraceTime timer("Start VMThread", TRACETIME_LOG(Info, startuptime));
 
@@ -2982,11 +2999,14 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     }
   }
 #endif
-  CompileBroker::compilation_init_phase1(CHECK_JNI_ERR);
-  // Postpone completion of compiler initialization to after JVMCI
-  // is initialized to avoid timeouts of blocking compilations.
-  if (JVMCI_ONLY(!force_JVMCI_intialization) NOT_JVMCI(true)) {
-    CompileBroker::compilation_init_phase2();
+  {
+    TraceTime timer("Initialize compilers", TRACETIME_LOG(Info, startuptime));
+    CompileBroker::compilation_init_phase1(CHECK_JNI_ERR);
+    // Postpone completion of compiler initialization to after JVMCI
+    // is initialized to avoid timeouts of blocking compilations.
+    if (JVMCI_ONLY(!force_JVMCI_intialization) NOT_JVMCI(true)) {
+      CompileBroker::compilation_init_phase2();
+    }
   }
 #endif
 
@@ -3022,6 +3042,8 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     java_lang_Throwable::print(PENDING_EXCEPTION, tty);
     vm_exit_during_initialization("ClassLoader::initialize_module_path() failed unexpectedly");
   }
+
+  DynamicArchive::start_auto_dump_task();
 #endif
 
 #if INCLUDE_JVMCI
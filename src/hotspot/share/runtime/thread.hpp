@@ -61,6 +61,7 @@ class ThreadsList;
 class ThreadsSMRSupport;
 
 class JNIHandleBlock;
+class JNIHandleCache;
 class JvmtiRawMonitor;
 class JvmtiSampledObjectAllocEventCollector;
 class JvmtiThreadState;
@@ -968,6 +969,10 @@ class JavaThread: public Thread {
   // Checked JNI: function name requires exception check
   char* _pending_jni_exception_check_fn;
 
+  // Entries cached for new global and weak global JNI handles
+  JNIHandleCache* _global_handle_cache;
+  JNIHandleCache* _weak_global_handle_cache;
+
   // For deadlock detection.
   int _depth_first_number;
 
@@ -1289,6 +1294,12 @@ class JavaThread: public Thread {
   static ByteSize should_post_on_exceptions_flag_offset() {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
+  static ByteSize profile_sample_countdown_offset() {
+    return byte_offset_of(JavaThread, _profile_sample_countdown);
+  }
+  static ByteSize profile_sample_seed_offset() {
+    return byte_offset_of(JavaThread, _profile_sample_seed);
+  }
   static ByteSize doing_unsafe_access_offset() { return byte_offset_of(JavaThread, _doing_unsafe_access); }
   NOT_PRODUCT(static ByteSize requires_cross_modify_fence_offset()  { return byte_offset_of(JavaThread, _requires_cross_modify_fence); })
 
@@ -1327,6 +1338,11 @@ class JavaThread: public Thread {
   const char* get_pending_jni_exception_check() const { return _pending_jni_exception_check_fn; }
   void set_pending_jni_exception_check(const char* fn_name) { _pending_jni_exception_check_fn = (char*) fn_name; }
 
+  JNIHandleCache* global_handle_cache() const               { return _global_handle_cache; }
+  void set_global_handle_cache(JNIHandleCache* cache)       { _global_handle_cache = cache; }
+  JNIHandleCache* weak_global_handle_cache() const          { return _weak_global_handle_cache; }
+  void set_weak_global_handle_cache(JNIHandleCache* cache)  { _weak_global_handle_cache = cache; }
+
   // For deadlock detection
   int depth_first_number() { return _depth_first_number; }
   void set_depth_first_number(int dfn) { _depth_first_number = dfn; }
@@ -1516,6 +1532,12 @@ class JavaThread: public Thread {
  private:
   int    _should_post_on_exceptions_flag;
 
+  // executions of profiled branches left until the next sampled update of
+  // the branch counters by tier 3 code, and the xor-shift state the next
+  // countdown is drawn from (see C1ProfileBranchSampleRate)
+  int    _profile_sample_countdown;
+  int    _profile_sample_seed;
+
  public:
   int   should_post_on_exceptions_flag()  { return _should_post_on_exceptions_flag; }
   void  set_should_post_on_exceptions_flag(int val)  { _should_post_on_exceptions_flag = val; }
@@ -32,8 +32,6 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/threadHeapSampler.hpp"
 
-// Cheap random number generator.
-uint64_t ThreadHeapSampler::_rnd;
 // Default is 512kb.
 volatile int ThreadHeapSampler::_sampling_interval = 512 * 1024;
 
@@ -31,8 +31,9 @@
 class ThreadHeapSampler {
  private:
   size_t _bytes_until_sample;
-  // Cheap random number generator
-  static uint64_t _rnd;
+  // Cheap random number generator, private to the owning thread so that
+  // picking the next sample does not write to state shared by all threads.
+  uint64_t _rnd;
 
   static volatile int _sampling_interval;
 
@@ -917,8 +917,12 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed.", os::current_thread_id(), p2i(threads));
   }
 
-  ValidateHazardPtrsClosure validate_cl;
-  threads_do(&validate_cl);
+  if (EnableThreadSMRExtraValidityChecks) {
+    // A second walk over all threads; optional so that workloads with
+    // high thread churn can drop it from every thread start and exit.
+    ValidateHazardPtrsClosure validate_cl;
+    threads_do(&validate_cl);
+  }
 
   delete scan_table;
 }
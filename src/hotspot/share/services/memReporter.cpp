@@ -247,6 +247,10 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (NMTDetailSamplingInterval > 1) {
+    out->print_cr("(Call stacks sampled for 1 in %u mallocs, the others are listed without a call stack.)\n",
+                  NMTDetailSamplingInterval);
+  }
 
   int num_omitted =
       report_malloc_sites() +
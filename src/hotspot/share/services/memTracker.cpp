@@ -43,6 +43,7 @@
 
 volatile NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
 NMT_TrackingLevel MemTracker::_cmdline_tracking_level = NMT_unknown;
+THREAD_LOCAL uint MemTracker::_malloc_stack_sample_count = 0;
 
 MemBaseline MemTracker::_baseline;
 bool MemTracker::_is_nmt_env_valid = true;
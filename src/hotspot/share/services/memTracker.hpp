@@ -33,6 +33,7 @@
 
 #define CURRENT_PC   NativeCallStack::empty_stack()
 #define CALLER_PC    NativeCallStack::empty_stack()
+#define MALLOC_CALLER_PC NativeCallStack::empty_stack()
 
 class Tracker : public StackObj {
  public:
@@ -80,6 +81,7 @@ class MemTracker : AllStatic {
 
 #else
 
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/mallocTracker.hpp"
@@ -90,6 +92,9 @@ class MemTracker : AllStatic {
                     NativeCallStack(0) : NativeCallStack::empty_stack())
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : NativeCallStack::empty_stack())
+// Used by the malloc entry points, honours NMTDetailSamplingInterval
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail && MemTracker::sample_malloc_stack()) ? \
+                          NativeCallStack(1) : NativeCallStack::empty_stack())
 
 class MemBaseline;
 
@@ -301,6 +306,20 @@ class MemTracker : AllStatic {
     return _cmdline_tracking_level;
   }
 
+  // Walking the stack dominates the cost of detail tracking. With
+  // NMTDetailSamplingInterval > 1 only every N-th malloc captures its call stack.
+  static inline bool sample_malloc_stack() {
+    if (NMTDetailSamplingInterval <= 1) {
+      return true;
+    }
+    // Counted per thread, so that mallocs on different threads don't
+    // contend on a shared counter.
+    uint n = _malloc_stack_sample_count + 1;
+    bool sample = n >= NMTDetailSamplingInterval;
+    _malloc_stack_sample_count = sample ? 0 : n;
+    return sample;
+  }
+
   static void tuning_statistics(outputStream* out);
 
  private:
@@ -315,6 +334,8 @@ class MemTracker : AllStatic {
   static bool                         _is_nmt_env_valid;
   // command line tracking level
   static NMT_TrackingLevel            _cmdline_tracking_level;
+  // Mallocs since the last sampled call stack
+  static THREAD_LOCAL uint            _malloc_stack_sample_count;
   // Stored baseline
   static MemBaseline      _baseline;
   // Query lock
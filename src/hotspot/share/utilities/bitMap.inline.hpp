@@ -211,7 +211,17 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? to_words_align_down(r_index) // Miniscule savings when aligned.
         : to_words_align_up(r_index);
-      while (++index < limit) {
+      // Sparse bitmaps, such as marking bitmaps, are mostly long runs of
+      // uninteresting words. Skip those several words at a time, with one
+      // test per group, and then locate the interesting word below.
+      ++index;
+      for (; index + 4 <= limit; index += 4) {
+        if (((map(index) ^ flip) | (map(index + 1) ^ flip) |
+             (map(index + 2) ^ flip) | (map(index + 3) ^ flip)) != 0) {
+          break;
+        }
+      }
+      for (; index < limit; ++index) {
         cword = map(index) ^ flip;
         if (cword != 0) {
           idx_t result = bit_index(index) + count_trailing_zeros(cword);
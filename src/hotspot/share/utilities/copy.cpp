@@ -33,13 +33,11 @@
 void Copy::conjoint_memory_atomic(const void* from, void* to, size_t size) {
   uintptr_t bits = (uintptr_t) from | (uintptr_t) to | (uintptr_t) size;
 
-  // (Note:  We could improve performance by ignoring the low bits of size,
-  // and putting a short cleanup loop after each bulk copy loop.
-  // There are plenty of other ways to make this faster also,
-  // and it's a slippery slope.  For now, let's keep this code simple
-  // since the simplicity helps clarify the atomicity semantics of
-  // this operation.  There are also CPU-specific assembly versions
-  // which may or may not want to include such optimizations.)
+  // (Note:  There are plenty of ways to make this faster, and it's a
+  // slippery slope.  Keep this code simple since the simplicity helps
+  // clarify the atomicity semantics of this operation.  There are also
+  // CPU-specific assembly versions which may or may not want to include
+  // such optimizations.)
 
   if (bits % sizeof(jlong) == 0) {
     Copy::conjoint_jlongs_atomic((const jlong*) from, (jlong*) to, size / sizeof(jlong));
@@ -47,6 +45,29 @@ void Copy::conjoint_memory_atomic(const void* from, void* to, size_t size) {
     Copy::conjoint_jints_atomic((const jint*) from, (jint*) to, size / sizeof(jint));
   } else if (bits % sizeof(jshort) == 0) {
     Copy::conjoint_jshorts_atomic((const jshort*) from, (jshort*) to, size / sizeof(jshort));
+  } else if (size >= 2 * sizeof(jlong) &&
+             (((uintptr_t) from ^ (uintptr_t) to) % sizeof(jlong)) == 0) {
+    // Not aligned, so no need to be atomic. Source and destination share
+    // their misalignment though, which is common for unaligned off-heap
+    // memory segments: peel bytes up to the next jlong boundary, copy the
+    // bulk in jlongs and finish with the remaining bytes.
+    size_t head = align_up((uintptr_t) to, sizeof(jlong)) - (uintptr_t) to;
+    size_t body = align_down(size - head, sizeof(jlong));
+    size_t tail = size - head - body;
+    const char* src = (const char*) from;
+    char* dst = (char*) to;
+    if (dst <= src || dst >= src + size) {
+      Copy::conjoint_jbytes(src, dst, head);
+      Copy::conjoint_jlongs_atomic((const jlong*) (src + head), (jlong*) (dst + head), body / sizeof(jlong));
+      Copy::conjoint_jbytes(src + head + body, dst + head + body, tail);
+    } else {
+      // Overlapping with the destination above the source: copy from
+      // higher to lower addresses, so no source byte is overwritten before
+      // it has been read.
+      Copy::conjoint_jbytes(src + head + body, dst + head + body, tail);
+      Copy::conjoint_jlongs_atomic((const jlong*) (src + head), (jlong*) (dst + head), body / sizeof(jlong));
+      Copy::conjoint_jbytes(src, dst, head);
+    }
   } else {
     // Not aligned, so no need to be atomic.
     Copy::conjoint_jbytes((const void*) from, (void*) to, size);
@@ -267,6 +288,15 @@ void Copy::fill_to_memory_atomic(void* to, size_t size, jubyte value) {
     for (uintptr_t off = 0; off < size; off += sizeof(jshort)) {
       *(jshort*)(dst + off) = fill;
     }
+  } else if (size >= 2 * sizeof(jlong)) {
+    // Not aligned, so no need to be atomic. Peel bytes up to the next
+    // jlong boundary, fill the bulk in jlongs and finish with the
+    // remaining bytes, rather than storing every byte separately.
+    size_t head = align_up((uintptr_t) dst, sizeof(jlong)) - (uintptr_t) dst;
+    size_t body = align_down(size - head, sizeof(jlong));
+    Copy::fill_to_bytes(dst, head, value);
+    Copy::fill_to_memory_atomic(dst + head, body, value);
+    Copy::fill_to_bytes(dst + head + body, size - head - body, value);
   } else {
     // Not aligned, so no need to be atomic.
     Copy::fill_to_bytes(dst, size, value);
@@ -244,3 +244,52 @@ TEST_VM(G1AdaptiveIHOPControl, humongous) {
 
   EXPECT_EQ(threshold, target_threshold);
 }
+
+TEST_VM(G1AdaptiveIHOPControl, allocation_rate_percentile) {
+  // Test requires G1
+  if (!UseG1GC) {
+    return;
+  }
+
+  const size_t initial_threshold = 45;
+  const size_t young_size = 10;
+  const size_t target_size = 100;
+  const double alloc_time = 1.0;
+  const size_t low_alloc_amount = 5;
+  const size_t burst_alloc_amount = 25;
+  const double marking_time = 2.0;
+
+  G1OldGenAllocationTracker alloc_tracker;
+  G1Predictions pred(0.95);
+  G1AdaptiveIHOPControl ctrl(initial_threshold, &alloc_tracker, &pred, 0, 0, 90);
+  ctrl.update_target_occupancy(target_size);
+
+  // Every fourth mutator period has an allocation burst. The 90th percentile of
+  // the recent allocation rates is the burst rate, which is higher than what the
+  // average based prediction gives.
+  for (int i = 0; i < 100; i++) {
+    size_t alloc_amount = (i % 4 == 3) ? burst_alloc_amount : low_alloc_amount;
+    test_update_allocation_tracker(&alloc_tracker, alloc_amount);
+    ctrl.update_allocation_info(alloc_time, young_size);
+    ctrl.update_marking_length(marking_time);
+  }
+
+  size_t threshold = ctrl.get_conc_mark_start_threshold();
+  size_t burst_threshold = target_size -
+    (size_t)(young_size + burst_alloc_amount / alloc_time * marking_time);
+
+  EXPECT_EQ(burst_threshold, threshold);
+
+  // Without the percentile, the threshold is based on the averages only and
+  // higher.
+  G1AdaptiveIHOPControl ctrl2(initial_threshold, &alloc_tracker, &pred, 0, 0);
+  ctrl2.update_target_occupancy(target_size);
+  for (int i = 0; i < 100; i++) {
+    size_t alloc_amount = (i % 4 == 3) ? burst_alloc_amount : low_alloc_amount;
+    test_update_allocation_tracker(&alloc_tracker, alloc_amount);
+    ctrl2.update_allocation_info(alloc_time, young_size);
+    ctrl2.update_marking_length(marking_time);
+  }
+
+  EXPECT_GT(ctrl2.get_conc_mark_start_threshold(), threshold);
+}
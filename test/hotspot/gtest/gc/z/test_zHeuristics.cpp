@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/z/zCPU.inline.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zHeuristics.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "unittest.hpp"
+
+TEST_VM(ZHeuristics, relocation_headroom) {
+  const size_t workers_headroom = (MAX2(ParallelGCThreads, ConcGCThreads) * ZPageSizeSmall) + ZPageSizeMedium;
+
+  {
+    FlagSetting fs(ZSeparateRelocationPages, false);
+    EXPECT_EQ(ZHeuristics::relocation_headroom(), workers_headroom);
+  }
+
+  {
+    // The shared small relocation pages of the mutators need headroom too
+    FlagSetting fs(ZSeparateRelocationPages, true);
+    const size_t nrelocation_pages = ZHeuristics::use_per_cpu_shared_small_pages() ? ZCPU::count() : 1;
+    EXPECT_EQ(ZHeuristics::relocation_headroom(), workers_headroom + (nrelocation_pages * ZPageSizeSmall));
+    EXPECT_GT(ZHeuristics::relocation_headroom(), workers_headroom);
+  }
+}
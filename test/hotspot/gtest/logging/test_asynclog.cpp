@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "logTestFixture.hpp"
+#include "logTestUtils.inline.hpp"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "runtime/globals.hpp"
+#include "unittest.hpp"
+
+// Installs an AsyncLogWriter whose thread is never started, so that logged
+// messages stay in its buffer until the test writes them out.
+class AsyncLogTest : public LogTestFixture {
+  AsyncLogWriter* _writer;
+  AsyncLogWriter* _saved_instance;
+
+ protected:
+  AsyncLogTest() : _writer(NULL), _saved_instance(NULL) { }
+
+  ~AsyncLogTest() {
+    if (_writer != NULL) {
+      _writer->write_all();
+      AsyncLogWriter::_instance = _saved_instance;
+      delete _writer;
+    }
+  }
+
+  void install_writer(size_t buffer_size) {
+    size_t saved_buffer_size = AsyncLogBufferSize;
+    AsyncLogBufferSize = buffer_size;
+    _writer = new AsyncLogWriter();
+    AsyncLogBufferSize = saved_buffer_size;
+    _saved_instance = AsyncLogWriter::_instance;
+    AsyncLogWriter::_instance = _writer;
+  }
+
+  static size_t message_size(const char* msg) {
+    return sizeof(AsyncLogMessage) + strlen(msg) + 1;
+  }
+};
+
+TEST_VM_F(AsyncLogTest, enqueue_and_flush_in_order) {
+  set_log_config(TestLogFileName, "logging=debug");
+  install_writer(AsyncLogBufferSize);
+
+  log_debug(logging)("async message 1");
+  log_debug(logging)("async message 2");
+  log_debug(logging)("async message 3");
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "async message 1"));
+
+  AsyncLogWriter::flush();
+  const char* expected[] = { "async message 1", "async message 2", "async message 3", NULL };
+  EXPECT_TRUE(file_contains_substrings_in_order(TestLogFileName, expected));
+}
+
+TEST_VM_F(AsyncLogTest, dropped_messages_are_reported) {
+  set_log_config(TestLogFileName, "logging=debug");
+  // Room for exactly one short message.
+  install_writer(message_size("async message 1"));
+
+  log_debug(logging)("async message 1");
+  log_debug(logging)("async message 2"); // Dropped, the buffer is full
+  AsyncLogWriter::flush();
+  log_debug(logging)("async message 3"); // Fits again, preceded by the note
+  AsyncLogWriter::flush();
+
+  const char* expected[] = { "async message 1",
+                             "1 messages dropped due to async logging",
+                             "async message 3", NULL };
+  EXPECT_TRUE(file_contains_substrings_in_order(TestLogFileName, expected));
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "async message 2"));
+}
+
+TEST_VM_F(AsyncLogTest, flush_on_output_deletion) {
+  set_log_config(TestLogFileName, "logging=debug");
+  install_writer(AsyncLogBufferSize);
+
+  log_debug(logging)("async message before deletion");
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "async message before deletion"));
+
+  // Turning off all tags on the output deletes it, which must write out the
+  // messages still buffered for it first.
+  set_log_config(TestLogFileName, "all=off");
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "async message before deletion"));
+}
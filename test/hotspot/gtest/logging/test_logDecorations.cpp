@@ -230,3 +230,25 @@ TEST(LogDecorations, identifiers) {
     EXPECT_EQ(ids[i].expected, strtol(reported, NULL, 10));
   }
 }
+
+// Test that a copy refers to its own buffer and keeps the decorations
+TEST_VM(LogDecorations, copy) {
+  LogDecorators selected_decorators;
+  ASSERT_TRUE(selected_decorators.parse("uptime,pid,tid,tags"));
+  LogDecorations decorations(LogLevel::Warning, tagset, selected_decorators);
+  LogDecorations copy(decorations);
+
+  const LogDecorators::Decorator decorators[] = {
+    LogDecorators::uptime_decorator,
+    LogDecorators::pid_decorator,
+    LogDecorators::tid_decorator,
+    LogDecorators::tags_decorator
+  };
+  for (uint i = 0; i < ARRAY_SIZE(decorators); i++) {
+    const char* original = decorations.decoration(decorators[i]);
+    const char* copied = copy.decoration(decorators[i]);
+    EXPECT_STREQ(original, copied);
+    EXPECT_NE(original, copied) << "Copy must not point into the original's buffer";
+  }
+  EXPECT_STREQ(LogLevel::name(LogLevel::Warning), copy.decoration(LogDecorators::level_decorator));
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package compiler.c2;
+
+import compiler.lib.ir_framework.*;
+
+/*
+ * @test
+ * @summary Loop invariant values are still hoisted once and give the same
+ *          results with and without -XX:HoistPressurePercent.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.c2.TestHoistPressureLimit
+ */
+public class TestHoistPressureLimit {
+    static final int SIZE = 1024;
+
+    static long[] a = new long[SIZE];
+    static int i0 = 1, i1 = 2, i2 = 3, i3 = 4, i4 = 5, i5 = 6, i6 = 7, i7 = 8;
+    static int i8 = 9, i9 = 10, i10 = 11, i11 = 12, i12 = 13, i13 = 14, i14 = 15, i15 = 16;
+
+    public static void main(String[] args) {
+        Scenario noLimit = new Scenario(0, "-XX:+UnlockExperimentalVMOptions", "-XX:HoistPressurePercent=0");
+        Scenario halfLimit = new Scenario(1, "-XX:+UnlockExperimentalVMOptions", "-XX:HoistPressurePercent=50");
+        Scenario tightLimit = new Scenario(2, "-XX:+UnlockExperimentalVMOptions", "-XX:HoistPressurePercent=1");
+        new TestFramework().addScenarios(noLimit, halfLimit, tightLimit).start();
+    }
+
+    // Sixteen loop invariant int values, more than the registers available for
+    // them on most platforms. The array holds longs so that only the invariant
+    // values are LoadI nodes. Loop opts move these out of the loop; the
+    // pressure limit only decides where global code motion places them, so
+    // each is still loaded only once however far the loop is unrolled.
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "16"})
+    public static long manyInvariants() {
+        long sum = 0;
+        for (int i = 0; i < SIZE; i++) {
+            sum += a[i] * i0 + (a[i] ^ i1) + (a[i] & i2) + (a[i] | i3)
+                 + a[i] * i4 + (a[i] ^ i5) + (a[i] & i6) + (a[i] | i7)
+                 + a[i] * i8 + (a[i] ^ i9) + (a[i] & i10) + (a[i] | i11)
+                 + a[i] * i12 + (a[i] ^ i13) + (a[i] & i14) + (a[i] | i15);
+        }
+        return sum;
+    }
+
+    static long expected() {
+        long sum = 0;
+        for (int i = 0; i < SIZE; i++) {
+            sum += a[i] * i0 + (a[i] ^ i1) + (a[i] & i2) + (a[i] | i3)
+                 + a[i] * i4 + (a[i] ^ i5) + (a[i] & i6) + (a[i] | i7)
+                 + a[i] * i8 + (a[i] ^ i9) + (a[i] & i10) + (a[i] | i11)
+                 + a[i] * i12 + (a[i] ^ i13) + (a[i] & i14) + (a[i] | i15);
+        }
+        return sum;
+    }
+
+    @Run(test = "manyInvariants")
+    @Warmup(0)
+    public static void runManyInvariants() {
+        for (int i = 0; i < SIZE; i++) {
+            a[i] = i * 31L - 7;
+        }
+        long result = manyInvariants();
+        long reference = expected();
+        if (result != reference) {
+            throw new RuntimeException("Wrong result: " + result + " != " + reference);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test id=merged
+ * @summary Directly adjacent allocations whose TLAB bumps are merged by
+ *          -XX:+MergeAdjacentAllocations are initialized like separate
+ *          allocations, on the fast and on the slow path.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions -XX:+MergeAdjacentAllocations
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   compiler.c2.TestMergeAdjacentAllocations
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions -XX:+MergeAdjacentAllocations
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -XX:TLABSize=2k -XX:-ResizeTLAB
+ *                   compiler.c2.TestMergeAdjacentAllocations
+ */
+
+/*
+ * @test id=print
+ * @summary C2 merges the TLAB bumps of directly adjacent allocations.
+ * @requires vm.compiler2.enabled & vm.debug
+ * @library /test/lib
+ * @run driver compiler.c2.TestMergeAdjacentAllocations print
+ */
+
+package compiler.c2;
+
+import java.util.Arrays;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMergeAdjacentAllocations {
+    static final int ITERATIONS = 200_000;
+
+    static class Point {
+        int x;
+        int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static class Line {
+        Point from;
+        Point to;
+    }
+
+    static Object sink;
+
+    // Three instances allocated one directly after the other.
+    static Line newLine(int x, int y) {
+        Point from = new Point(x, y);
+        Point to = new Point(y, x);
+        Line line = new Line();
+        line.from = from;
+        line.to = to;
+        return line;
+    }
+
+    // Constant size arrays, only the first one is written.
+    static long[][] newArrays(long v) {
+        long[] a = new long[5];
+        long[] b = new long[3];
+        a[4] = v;
+        return new long[][] { a, b };
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals("print")) {
+            ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-Xbatch",
+                "-XX:+UnlockExperimentalVMOptions", "-XX:+MergeAdjacentAllocations",
+                "-XX:+PrintEliminateAllocations",
+                TestMergeAdjacentAllocations.class.getName());
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Merged allocations");
+            return;
+        }
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            Line line = newLine(i, -i);
+            check(line.from != line.to, "distinct objects");
+            check(line.from.x == i && line.from.y == -i, "first point");
+            check(line.to.x == -i && line.to.y == i, "second point");
+
+            long[][] arrays = newArrays(i);
+            check(arrays[0].length == 5 && arrays[1].length == 3, "array lengths");
+            check(arrays[0][4] == i, "written element");
+            check(Arrays.equals(arrays[0], 0, 4, new long[4], 0, 4), "zeroed first array");
+            check(Arrays.equals(arrays[1], new long[3]), "zeroed second array");
+
+            sink = line;
+            if (i % 50_000 == 0) {
+                System.gc();
+            }
+        }
+    }
+}
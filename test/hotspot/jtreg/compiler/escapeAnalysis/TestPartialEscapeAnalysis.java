@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package compiler.escapeAnalysis;
+
+import compiler.lib.ir_framework.*;
+
+/*
+ * @test
+ * @summary With -XX:+PartialEscapeAnalysis an object that only escapes into calls is
+ *          allocated right before each of them, and the calls see its current state.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.escapeAnalysis.TestPartialEscapeAnalysis
+ */
+public class TestPartialEscapeAnalysis {
+    static class Point {
+        int x;
+        int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static long sum;
+
+    public static void main(String[] args) {
+        Scenario off = new Scenario(0, "-XX:+UnlockExperimentalVMOptions", "-XX:-PartialEscapeAnalysis");
+        Scenario on = new Scenario(1, "-XX:+UnlockExperimentalVMOptions", "-XX:+PartialEscapeAnalysis");
+        new TestFramework().addScenarios(off, on).start();
+    }
+
+    @DontInline
+    static void sink(Point p) {
+        sum += p.x * 31L + p.y;
+    }
+
+    // Without partial escape analysis the object escapes on all paths and is
+    // allocated once up front. With it, a copy is allocated before each call
+    // and the original is scalar replaced.
+    @Test
+    @IR(applyIf = {"PartialEscapeAnalysis", "false"}, counts = {IRNode.ALLOC, "1"})
+    @IR(applyIf = {"PartialEscapeAnalysis", "true"}, counts = {IRNode.ALLOC, "2"})
+    public static int escapeOnTwoPaths(int x, int y, int sel) {
+        Point p = new Point(x, y);
+        int result = p.x + p.y;
+        if (sel == 1) {
+            sink(p);
+        } else if (sel == 2) {
+            p.x++;
+            sink(p);
+        }
+        return result;
+    }
+
+    @Run(test = "escapeOnTwoPaths")
+    public static void runEscapeOnTwoPaths() {
+        for (int sel = 0; sel < 3; sel++) {
+            sum = 0;
+            int result = escapeOnTwoPaths(3, 4, sel);
+            long expected = sel == 0 ? 0 : (sel == 1 ? 3 * 31L + 4 : 4 * 31L + 4);
+            if (result != 7 || sum != expected) {
+                throw new RuntimeException("sel " + sel + ": result " + result + ", sum " + sum +
+                                           " != " + expected);
+            }
+        }
+    }
+
+    // The field is stored after the call, so the object is not materialized
+    // and still escapes on all paths.
+    @Test
+    @IR(counts = {IRNode.ALLOC, "1"})
+    public static int storeAfterCall(int x, int y, boolean escape) {
+        Point p = new Point(x, y);
+        if (escape) {
+            sink(p);
+        }
+        p.y = x;
+        return p.x + p.y;
+    }
+
+    @Run(test = "storeAfterCall")
+    public static void runStoreAfterCall() {
+        for (int i = 0; i < 2; i++) {
+            sum = 0;
+            boolean escape = i == 1;
+            int result = storeAfterCall(5, 6, escape);
+            long expected = escape ? 5 * 31L + 6 : 0;
+            if (result != 10 || sum != expected) {
+                throw new RuntimeException("escape " + escape + ": result " + result + ", sum " + sum +
+                                           " != " + expected);
+            }
+        }
+    }
+}
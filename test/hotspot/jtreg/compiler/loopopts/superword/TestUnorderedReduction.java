@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package compiler.loopopts.superword;
+
+import java.util.Random;
+
+/*
+ * @test
+ * @summary Unordered int and long reductions accumulated in a vector and reduced
+ *          after the loop give the same results as the scalar loop, including
+ *          for zero-trip and strip-mined loops.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestUnorderedReduction::ref*
+ *                   compiler.loopopts.superword.TestUnorderedReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UseCountedLoopSafepoints -XX:LoopStripMiningIter=1000
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestUnorderedReduction::ref*
+ *                   compiler.loopopts.superword.TestUnorderedReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:LoopStripMiningIter=0
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestUnorderedReduction::ref*
+ *                   compiler.loopopts.superword.TestUnorderedReduction
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-SuperWordReductions
+ *                   -XX:CompileCommand=exclude,compiler.loopopts.superword.TestUnorderedReduction::ref*
+ *                   compiler.loopopts.superword.TestUnorderedReduction
+ */
+public class TestUnorderedReduction {
+    static final int SIZE = 10_000;
+    // Zero-trip, shorter than one vector, not a multiple of the unrolled
+    // body, and long enough to be strip mined.
+    static final int[] LENGTHS = { 0, 1, 3, 17, 1023, SIZE };
+    static final int WARMUP = 10_000;
+
+    static int[] ints = new int[SIZE];
+    static long[] longs = new long[SIZE];
+    static int intInit = 42;
+    static long longInit = 42L << 33;
+
+    public static void main(String[] args) {
+        Random random = new Random(1234);
+        for (int i = 0; i < SIZE; i++) {
+            // Odd values, so that products do not collapse to zero.
+            ints[i] = random.nextInt() | 1;
+            longs[i] = random.nextLong() | 1;
+        }
+        for (int iter = 0; iter < WARMUP; iter++) {
+            run(LENGTHS[iter % LENGTHS.length]);
+        }
+        for (int n : LENGTHS) {
+            run(n);
+        }
+    }
+
+    static void run(int n) {
+        verify("int add", n, testIntAdd(intInit, ints, n), refIntAdd(intInit, ints, n));
+        verify("int mul", n, testIntMul(intInit, ints, n), refIntMul(intInit, ints, n));
+        verify("int min", n, testIntMin(intInit, ints, n), refIntMin(intInit, ints, n));
+        verify("int max", n, testIntMax(intInit, ints, n), refIntMax(intInit, ints, n));
+        verify("int and", n, testIntAnd(intInit, ints, n), refIntAnd(intInit, ints, n));
+        verify("int or", n, testIntOr(intInit, ints, n), refIntOr(intInit, ints, n));
+        verify("int xor", n, testIntXor(intInit, ints, n), refIntXor(intInit, ints, n));
+        verify("long add", n, testLongAdd(longInit, longs, n), refLongAdd(longInit, longs, n));
+        verify("long mul", n, testLongMul(longInit, longs, n), refLongMul(longInit, longs, n));
+        verify("long min", n, testLongMin(longInit, longs, n), refLongMin(longInit, longs, n));
+        verify("long max", n, testLongMax(longInit, longs, n), refLongMax(longInit, longs, n));
+        verify("long and", n, testLongAnd(longInit, longs, n), refLongAnd(longInit, longs, n));
+        verify("long or", n, testLongOr(longInit, longs, n), refLongOr(longInit, longs, n));
+        verify("long xor", n, testLongXor(longInit, longs, n), refLongXor(longInit, longs, n));
+    }
+
+    static void verify(String what, int n, long result, long expected) {
+        if (result != expected) {
+            throw new RuntimeException(what + " reduction over " + n + " elements: " +
+                                       result + " != " + expected);
+        }
+    }
+
+    static int testIntAdd(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static int refIntAdd(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static int testIntMul(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r *= a[i];
+        }
+        return r;
+    }
+
+    static int refIntMul(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r *= a[i];
+        }
+        return r;
+    }
+
+    static int testIntMin(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.min(r, a[i]);
+        }
+        return r;
+    }
+
+    static int refIntMin(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.min(r, a[i]);
+        }
+        return r;
+    }
+
+    static int testIntMax(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.max(r, a[i]);
+        }
+        return r;
+    }
+
+    static int refIntMax(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.max(r, a[i]);
+        }
+        return r;
+    }
+
+    static int testIntAnd(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r &= a[i];
+        }
+        return r;
+    }
+
+    static int refIntAnd(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r &= a[i];
+        }
+        return r;
+    }
+
+    static int testIntOr(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r |= a[i];
+        }
+        return r;
+    }
+
+    static int refIntOr(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r |= a[i];
+        }
+        return r;
+    }
+
+    static int testIntXor(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r ^= a[i];
+        }
+        return r;
+    }
+
+    static int refIntXor(int init, int[] a, int n) {
+        int r = init;
+        for (int i = 0; i < n; i++) {
+            r ^= a[i];
+        }
+        return r;
+    }
+
+    static long testLongAdd(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static long refLongAdd(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r += a[i];
+        }
+        return r;
+    }
+
+    static long testLongMul(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r *= a[i];
+        }
+        return r;
+    }
+
+    static long refLongMul(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r *= a[i];
+        }
+        return r;
+    }
+
+    static long testLongMin(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.min(r, a[i]);
+        }
+        return r;
+    }
+
+    static long refLongMin(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.min(r, a[i]);
+        }
+        return r;
+    }
+
+    static long testLongMax(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.max(r, a[i]);
+        }
+        return r;
+    }
+
+    static long refLongMax(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r = Math.max(r, a[i]);
+        }
+        return r;
+    }
+
+    static long testLongAnd(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r &= a[i];
+        }
+        return r;
+    }
+
+    static long refLongAnd(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r &= a[i];
+        }
+        return r;
+    }
+
+    static long testLongOr(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r |= a[i];
+        }
+        return r;
+    }
+
+    static long refLongOr(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r |= a[i];
+        }
+        return r;
+    }
+
+    static long testLongXor(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r ^= a[i];
+        }
+        return r;
+    }
+
+    static long refLongXor(long init, long[] a, int n) {
+        long r = init;
+        for (int i = 0; i < n; i++) {
+            r ^= a[i];
+        }
+        return r;
+    }
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package compiler.rangechecks;
+
+import java.util.Objects;
+
+/*
+ * @test
+ * @summary Long range checks in long counted loops that are turned into int range checks
+ *          in the inner loop of the loop nest still pass and fail exactly where the long
+ *          checks do, for positive and negative scales and strides, for offsets that
+ *          overflow, and for accesses that are out of bounds.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=exclude,compiler.rangechecks.TestLongRangeCheck::ref*
+ *                   compiler.rangechecks.TestLongRangeCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseLoopPredicate
+ *                   -XX:CompileCommand=exclude,compiler.rangechecks.TestLongRangeCheck::ref*
+ *                   compiler.rangechecks.TestLongRangeCheck
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-RangeCheckElimination
+ *                   -XX:CompileCommand=exclude,compiler.rangechecks.TestLongRangeCheck::ref*
+ *                   compiler.rangechecks.TestLongRangeCheck
+ */
+public class TestLongRangeCheck {
+    static final long RANGE = 100_000;
+    static final long BIG = 1L << 40;
+
+    // { start, stop, offset, range } for loops counting up. Loops counting
+    // down swap start and stop.
+    static final long[][] CASES = {
+        // In bounds for the positive scales.
+        { 0, 1000, 0, RANGE },
+        { 10, 5000, 17, RANGE },
+        // In bounds for the negative scales.
+        { 0, 1000, RANGE - 1, RANGE },
+        { -5000, 0, 0, RANGE },
+        // Large iv values and offsets that cancel out.
+        { BIG, BIG + 1000, -3 * BIG, RANGE },
+        { -BIG, -BIG + 1000, 3 * BIG, RANGE },
+        { BIG, BIG + 1000, 3 * BIG, RANGE },
+        { -BIG, -BIG + 1000, -3 * BIG, RANGE },
+        // Offsets that overflow when the scaled iv is added.
+        { 0, 1000, Long.MAX_VALUE - 10, RANGE },
+        { 0, 1000, Long.MIN_VALUE + 10, RANGE },
+        { 0, 1000, Long.MAX_VALUE, Long.MAX_VALUE },
+        { -1000, 0, Long.MIN_VALUE, Long.MAX_VALUE },
+        // Range larger than max_jint.
+        { 0, 1000, (long)Integer.MAX_VALUE - 100, (long)Integer.MAX_VALUE + 100 },
+        { 0, 1000, BIG, 2 * BIG },
+        // Out of bounds in the middle of the loop.
+        { 0, 20_000, 0, 5_000 },
+        { 0, 20_000, 10_000, 20_000 },
+        { -20_000, 20_000, 0, RANGE },
+        // Out of bounds on the first iteration.
+        { 0, 1000, -1, RANGE },
+        { 0, 1000, RANGE, RANGE },
+        // Empty and zero-trip.
+        { 0, 1000, 0, 0 },
+        { 1000, 0, 0, RANGE },
+    };
+    static final int WARMUP = 2_000;
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < WARMUP; iter++) {
+            run(CASES[iter % CASES.length]);
+        }
+        for (long[] c : CASES) {
+            run(c);
+        }
+    }
+
+    static void run(long[] c) {
+        for (int down = 0; down < 2; down++) {
+            long start = down == 0 ? c[0] : c[1];
+            long stop = down == 0 ? c[1] : c[0];
+            long offset = c[2];
+            long range = c[3];
+        verify("PosScalePosStride", start, stop, offset, range,
+               testPosScalePosStride(start, stop, offset, range), refPosScalePosStride(start, stop, offset, range));
+        verify("NegScalePosStride", start, stop, offset, range,
+               testNegScalePosStride(start, stop, offset, range), refNegScalePosStride(start, stop, offset, range));
+        verify("PosScaleNegStride", start, stop, offset, range,
+               testPosScaleNegStride(start, stop, offset, range), refPosScaleNegStride(start, stop, offset, range));
+        verify("NegScaleNegStride", start, stop, offset, range,
+               testNegScaleNegStride(start, stop, offset, range), refNegScaleNegStride(start, stop, offset, range));
+        verify("UnitScaleLargeStride", start, stop, offset, range,
+               testUnitScaleLargeStride(start, stop, offset, range), refUnitScaleLargeStride(start, stop, offset, range));
+        }
+    }
+
+    // The methods return the number of checks that passed, or -(count + 1)
+    // if a check threw after count checks passed.
+    static void verify(String what, long start, long stop, long offset, long range, long result, long expected) {
+        if (result != expected) {
+            throw new RuntimeException(what + " start=" + start + " stop=" + stop + " offset=" + offset +
+                                       " range=" + range + ": " + result + " != " + expected);
+        }
+    }
+
+    static long testPosScalePosStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i < stop; i += 1) {
+                Objects.checkIndex(3L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long refPosScalePosStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i < stop; i += 1) {
+                Objects.checkIndex(3L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long testNegScalePosStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i < stop; i += 1) {
+                Objects.checkIndex(-3L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long refNegScalePosStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i < stop; i += 1) {
+                Objects.checkIndex(-3L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long testPosScaleNegStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i > stop; i -= 2) {
+                Objects.checkIndex(5L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long refPosScaleNegStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i > stop; i -= 2) {
+                Objects.checkIndex(5L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long testNegScaleNegStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i > stop; i -= 2) {
+                Objects.checkIndex(-5L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long refNegScaleNegStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i > stop; i -= 2) {
+                Objects.checkIndex(-5L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long testUnitScaleLargeStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i < stop; i += 1000) {
+                Objects.checkIndex(1L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+
+    static long refUnitScaleLargeStride(long start, long stop, long offset, long range) {
+        long count = 0;
+        try {
+            for (long i = start; i < stop; i += 1000) {
+                Objects.checkIndex(1L * i + offset, range);
+                count++;
+            }
+        } catch (IndexOutOfBoundsException e) {
+            return -count - 1;
+        }
+        return count;
+    }
+}
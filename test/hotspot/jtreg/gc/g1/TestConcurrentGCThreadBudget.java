@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestConcurrentGCThreadBudget
+ * @summary Test that G1 background threads make progress when sharing a small budget.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver gc.g1.TestConcurrentGCThreadBudget
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+class TestConcurrentGCThreadBudgetAllocate {
+
+    public static ArrayList<Object> list = new ArrayList<Object>();
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 100; i++) {
+            Object[] refs = new Object[1024];
+            for (int j = 0; j < 100 * 1024; j++) {
+                // Old-to-young references and duplicate strings keep
+                // refinement and deduplication busy.
+                refs[j % refs.length] = new String("duplicate" + (j % 16));
+            }
+            list.add(refs);
+            if (list.size() > 50) {
+                list.clear();
+            }
+        }
+    }
+}
+
+public class TestConcurrentGCThreadBudget {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xmx64M",
+            "-XX:+UseStringDeduplication",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:ConcGCThreadBudgetPercent=1",
+            "-Xlog:gc+init",
+            TestConcurrentGCThreadBudgetAllocate.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("Concurrent GC Thread Budget: 1");
+        output.shouldHaveExitValue(0);
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestConcurrentPreTouch
+ * @summary Test that G1 pretouches committed free regions in the background.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver gc.g1.TestConcurrentPreTouch
+ */
+
+import java.util.LinkedList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+class TestConcurrentPreTouchAllocate {
+
+    public static LinkedList<Object> garbageList = new LinkedList<Object>();
+
+    public static void main(String[] args) throws Exception {
+        // Give the service thread time to pretouch the initial heap.
+        Thread.sleep(1000);
+        for (int i = 0; i < 100; i++) {
+            for (int j = 0; j < 1024; j++) {
+                garbageList.add(new int[256]);
+            }
+            garbageList.clear();
+        }
+    }
+}
+
+public class TestConcurrentPreTouch {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UseG1GC",
+            "-Xms64M",
+            "-Xmx128M",
+            "-XX:-AlwaysPreTouch",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+G1ConcurrentPreTouch",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+VerifyAfterGC",
+            "-Xlog:gc+heap=debug",
+            TestConcurrentPreTouchAllocate.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldContain("Concurrent PreTouch Summary");
+        output.shouldHaveExitValue(0);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestRemsetFullRegionCoarsening
+ * @requires vm.gc.G1
+ * @summary Verify that replacing dense fine-grain remembered set tables by
+ *          coarse entries keeps the remembered sets complete.
+ * @library /test/lib
+ * @library /
+ * @modules java.base/jdk.internal.misc
+ *          java.management/sun.management
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestRemsetFullRegionCoarsening
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestRemsetFullRegionCoarsening {
+
+    static class CrossRegionReferences {
+        private static final int NUM_ARRAYS = 64;
+        private static final int ARRAY_LENGTH = 16 * 1024;
+
+        public static void main(String[] args) {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+
+            Object[][] arrays = new Object[NUM_ARRAYS][];
+            for (int i = 0; i < NUM_ARRAYS; i++) {
+                arrays[i] = new Object[ARRAY_LENGTH];
+            }
+            // Promote the arrays to the old generation.
+            wb.fullGC();
+
+            // Create references from every array into the others so that
+            // the remembered sets of the old regions become dense.
+            for (int round = 0; round < 4; round++) {
+                for (int i = 0; i < NUM_ARRAYS; i++) {
+                    Object[] from = arrays[i];
+                    for (int j = 0; j < ARRAY_LENGTH; j++) {
+                        from[j] = arrays[(i + j + round) % NUM_ARRAYS];
+                    }
+                }
+                wb.youngGC();
+            }
+            wb.fullGC();
+        }
+    }
+
+    private static void runTest(String occupancyPercent) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-Xms64m",
+            "-Xmx64m",
+            "-XX:G1HeapRegionSize=1M",
+            "-XX:G1RSetFullRegionOccupancyPercent=" + occupancyPercent,
+            "-XX:+VerifyBeforeGC",
+            "-XX:+VerifyAfterGC",
+            "-XX:+G1VerifyRSetsDuringFullGC",
+            "-Xlog:gc+remset+exit=trace",
+            CrossRegionReferences.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+    }
+
+    public static void main(String[] args) throws Exception {
+        runTest("1");
+        runTest("50");
+        runTest("100");
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Test -XX:AutoArchiveClassesFile with a missing, a valid and a stale archive.
+ * @requires vm.cds
+ * @library /test/lib
+ * @run driver AutoArchiveClassesFile
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class AutoArchiveClassesFile {
+    static final String APP = "AutoArchiveClassesFile$App";
+
+    public static void main(String[] args) throws Exception {
+        Path classes = Paths.get(System.getProperty("test.classes"));
+        Path otherClasses = Files.createDirectories(Paths.get("other-classes"));
+        Files.copy(classes.resolve(APP + ".class"), otherClasses.resolve(APP + ".class"));
+
+        File archive = new File("auto.jsa");
+        archive.delete();
+
+        // Missing archive: the VM runs without it and writes it once class loading settles.
+        run(classes.toString(), archive)
+            .shouldContain("writing dynamic archive " + archive)
+            .shouldNotContain("Could not write dynamic archive")
+            .shouldHaveExitValue(0);
+        if (!archive.exists()) {
+            throw new RuntimeException(archive + " was not written");
+        }
+
+        // Valid archive: it is mapped and not written again.
+        run(classes.toString(), archive)
+            .shouldContain("Using dynamic archive " + archive)
+            .shouldNotContain("writing dynamic archive")
+            .shouldHaveExitValue(0);
+
+        // Stale archive: the classpath no longer matches, so it is not mapped. It must be
+        // replaced without tripping over SharedArchiveFile pointing at the same file.
+        run(otherClasses.toString(), archive)
+            .shouldNotContain("Using dynamic archive")
+            .shouldContain("writing dynamic archive " + archive)
+            .shouldNotContain("Cannot have the same archive file")
+            .shouldNotContain("Could not write dynamic archive")
+            .shouldHaveExitValue(0);
+
+        // The rewritten archive matches the new classpath.
+        run(otherClasses.toString(), archive)
+            .shouldContain("Using dynamic archive " + archive)
+            .shouldHaveExitValue(0);
+    }
+
+    static OutputAnalyzer run(String classPath, File archive) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:AutoArchiveClassesFile=" + archive,
+            "-XX:AutoArchiveClassesSettleTime=1",
+            "-Xlog:cds+dynamic=info",
+            "-cp", classPath,
+            APP);
+        OutputAnalyzer output = ProcessTools.executeProcess(pb);
+        output.reportDiagnosticSummary();
+        return output;
+    }
+
+    static class App {
+        public static void main(String[] args) throws Exception {
+            // Load some classes, then stay idle long enough for the settle time to pass
+            // and the dump to complete.
+            new java.util.concurrent.ConcurrentSkipListMap<String, String>().put("a", "b");
+            Thread.sleep(5000);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Smoke test for -Xlog:async: file output is written by the async
+ *          log thread and everything logged is on disk at exit.
+ * @library /test/lib
+ * @run driver AsyncLogTest
+ */
+
+import java.io.File;
+import java.nio.file.Files;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class AsyncLogTest {
+    public static void main(String[] args) throws Exception {
+        File logFile = new File("async.log");
+        logFile.delete();
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xlog:async",
+            "-Xlog:gc*=debug,safepoint=info,logging+thread=debug:file=" + logFile,
+            "-Xlog:gc=info:stdout",
+            AsyncLogTest.App.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        output.shouldHaveExitValue(0);
+        // Output to stdout stays synchronous.
+        output.shouldContain("Pause Full (System.gc())");
+
+        OutputAnalyzer log = new OutputAnalyzer(Files.readString(logFile.toPath()));
+        log.shouldContain("Async logging thread started.");
+        log.shouldContain("Pause Full (System.gc())");
+        // Messages logged right before exit are flushed too.
+        log.shouldMatch("\\[gc,heap,exit\\s*\\]");
+    }
+
+    public static class App {
+        public static void main(String[] args) {
+            for (int i = 0; i < 5; i++) {
+                System.gc();
+            }
+        }
+    }
+}
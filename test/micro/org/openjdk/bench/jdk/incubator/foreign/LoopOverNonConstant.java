@@ -134,6 +134,24 @@ public class LoopOverNonConstant {
         return sum;
     }
 
+    @Benchmark
+    public int segment_loop_static_long() {
+        int res = 0;
+        for (long i = 0; i < ELEM_SIZE; i ++) {
+            res += MemoryAccess.getIntAtIndex(segment, i);
+        }
+        return res;
+    }
+
+    @Benchmark
+    public int segment_loop_long() {
+        int sum = 0;
+        for (long i = 0; i < ELEM_SIZE; i++) {
+            sum += (int) VH_int.get(segment, i);
+        }
+        return sum;
+    }
+
     @Benchmark
     public int segment_loop_slice() {
         int sum = 0;
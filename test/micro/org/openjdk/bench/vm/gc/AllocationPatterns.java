@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation patterns that stress different GC hot paths: TLAB refills,
+ * outside-TLAB and humongous allocation, promotion of medium-lived objects,
+ * and old-to-young reference stores that go through the card table or
+ * remembered sets. Run with the collector under test, e.g.
+ * -jvmArgsAppend -XX:+UseParallelGC.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xmx1g", "-Xms1g" })
+public class AllocationPatterns {
+
+    static class Node {
+        Node next;
+        Object payload;
+    }
+
+    /** Number of entries kept alive, so they survive young collections. */
+    @Param({"1024", "65536"})
+    public int retained;
+
+    private Node[] ring;
+    private int cursor;
+
+    @Setup
+    public void setup() {
+        ring = new Node[retained];
+        for (int i = 0; i < retained; i++) {
+            ring[i] = new Node();
+        }
+        cursor = 0;
+    }
+
+    private int nextSlot() {
+        int slot = cursor;
+        cursor = (slot + 1 == retained) ? 0 : slot + 1;
+        return slot;
+    }
+
+    @Benchmark
+    public Object smallObjects() {
+        return new Node();
+    }
+
+    @Benchmark
+    public Object mediumArrays() {
+        return new byte[4 * 1024];
+    }
+
+    @Benchmark
+    public Object largeArrays() {
+        // Larger than half of the default G1 region size.
+        return new byte[4 * 1024 * 1024];
+    }
+
+    @Benchmark
+    public void mediumLived() {
+        // Replaces a retained entry; the old one becomes garbage after
+        // surviving for 'retained' iterations.
+        ring[nextSlot()] = new Node();
+    }
+
+    @Benchmark
+    public void oldToYoungStores() {
+        // The ring entries are promoted after warmup, so storing fresh
+        // objects into them creates old-to-young references.
+        ring[nextSlot()].payload = new Node();
+    }
+
+    @Benchmark
+    public void linkedLists() {
+        Node head = null;
+        for (int i = 0; i < 16; i++) {
+            Node n = new Node();
+            n.next = head;
+            head = n;
+        }
+        ring[nextSlot()].next = head;
+    }
+}